@@ -15,23 +15,39 @@ class AnimatedTexture: public Texture
 	public:
 		/** Create an animated texture.
 		 * @param pointerSDLTexture The SDL texture to use.
+		 * @param pointerSourceRectangle The location in the SDL texture of the strip containing all images.
 		 * @param imagesCount How many single images are present in the provided texture.
 		 * @param framesPerImageCount How many game frames to wait between each single image displaying.
 		 * @param isAnimationLooping Set to true to make the animation loop forever, set to false to display the animation only once.
 		 * @note Texture starts playing from the first image.
 		 */
-		AnimatedTexture(SDL_Texture *pointerSDLTexture, int imagesCount, int framesPerImageCount, bool isAnimationLooping);
+		AnimatedTexture(SDL_Texture *pointerSDLTexture, const SDL_Rect *pointerSourceRectangle, int imagesCount, int framesPerImageCount, bool isAnimationLooping);
 		
 		/** Free allocated resources. */
 		virtual ~AnimatedTexture() {}
 		
-		/** Render the texture using the main renderer. The provided coordinates indicate texture's top left angle.
-		 * @param x X coordinate where to draw the texture on the display.
-		 * @param y Y coordinate where to draw the texture on the display.
+		/** Take the texture memory from a pool instead of the heap.
+		 * @param size The texture size in bytes.
+		 * @return The texture memory.
+		 */
+		static void *operator new(size_t size);
+		
+		/** Give the texture memory back to its pool.
+		 * @param pointerObject The texture memory.
+		 */
+		static void operator delete(void *pointerObject);
+		
+		/** Make the animation progress by one game frame. Animation is advanced on game logic update instead of rendering, so it still progresses when nothing is displayed.
 		 * @return 0 if the animation is not finished,
 		 * @return 1 if the animation has finished playing (only if the texture was created with isAnimationLooping set to false).
 		 */
+		int update();
+		
+		// No need for documentation because it is the same as parent function
 		virtual int render(int x, int y);
+		
+		// No need for documentation because it is the same as parent function
+		virtual void getDisplayedSourceRectangle(SDL_Rect *pointerRectangle);
 	
 	protected:
 		/** How many static images are contained in the provided image file. */
@@ -23,18 +23,26 @@ class AnimatedTextureStaticEntity: public StaticEntity
 		// No need for documentation because it is the same as parent function
 		virtual ~AnimatedTextureStaticEntity();
 		
-		// No need for documentation because it is the same as parent function
-		virtual void render();
+		/** Take the effect memory from a pool instead of the heap.
+		 * @param size The effect size in bytes.
+		 * @return The effect memory.
+		 */
+		static void *operator new(size_t size);
+		
+		/** Give the effect memory back to its pool.
+		 * @param pointerObject The effect memory.
+		 */
+		static void operator delete(void *pointerObject);
 		
-		/** Tell whether the animation finished playing.
+		/** Make the animation progress and tell whether it finished playing.
 		 * @return 0 while the animation must be displayed,
 		 * @return 1 when the animation is finished and the object must be destroyed.
 		 */
 		virtual int update();
 
 	private:
-		/** Tell whether the animation finished playing. */
-		int _isAnimationTerminated;
+		/** The same texture than the parent class one, but with its real type to allow the animation to be updated. */
+		AnimatedTexture *_pointerAnimatedTexture;
 };
 
 #endif
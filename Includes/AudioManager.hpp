@@ -34,10 +34,11 @@ namespace AudioManager
 	} SoundId;
 
 	/** Load all game sounds.
+	 * @param isAudioDeviceEnabled Set to true to open the audio device and load all sounds, set to false to run without any audio device (all sound playing functions do nothing in this case).
 	 * @return 0 if all files were successfully loaded,
 	 * @return -1 if an error occurred.
 	 */
-	int initialize();
+	int initialize(bool isAudioDeviceEnabled);
 
 	/** Free all allocated resources. */
 	void uninitialize();
@@ -21,12 +21,23 @@ class BigEnemyFightingEntity: public EnemyFightingEntity
 		/** Free allocated resources. */
 		virtual ~BigEnemyFightingEntity();
 		
+		/** Take the enemy memory from a pool instead of the heap.
+		 * @param size The enemy size in bytes.
+		 * @return The enemy memory.
+		 */
+		static void *operator new(size_t size);
+		
+		/** Give the enemy memory back to its pool.
+		 * @param pointerObject The enemy memory.
+		 */
+		static void operator delete(void *pointerObject);
+		
 		// No need for documentation because it is the same as parent function
 		virtual int update();
 
 	protected:
 		// No need for documentation because it is the same as parent function
-		virtual BulletMovingEntity *_fireBullet(int x, int y);
+		virtual void _fireBullet(BulletStore *pointerBulletStore, int x, int y);
 };
 
 #endif
@@ -0,0 +1,165 @@
+/** @file BulletStore.hpp
+ * @author Adrien RICCIARDI
+ */
+#ifndef HPP_BULLET_STORE_HPP
+#define HPP_BULLET_STORE_HPP
+
+#include <Configuration.hpp>
+#include <MovingEntity.hpp>
+#include <SDL2/SDL.h>
+#include <Texture.hpp>
+#include <TextureManager.hpp>
+
+/** @class BulletStore
+ * All bullets fired by the player or by the enemies. Each bullet attribute is stored in its own array, so all bullets can be moved by tight loops and no memory is allocated when a bullet is fired.
+ */
+class BulletStore
+{
+	public:
+		/** Create an empty store. */
+		BulletStore();
+		
+		/** Fire a new bullet. Nothing is done if the store is full.
+		 * @param x Spawning X coordinate.
+		 * @param y Spawning Y coordinate.
+		 * @param facingUpTextureId The bullet texture when it is facing up. This texture ID must be followed by facing down, facing left and facing right textures (in this order).
+		 * @param movingPixelsAmount Bullet moving speed in pixels.
+		 * @param facingDirection In which direction the bullet will move.
+		 * @param damageAmount How many life points the bullet removes when it hits an entity.
+		 * @param isEnemySpawnerDamageable Set to true to make the bullet damage enemy spawners, set to false to make the bullet explode on enemy spawners.
+		 */
+		void addBullet(int x, int y, TextureManager::TextureId facingUpTextureId, int movingPixelsAmount, MovingEntity::Direction facingDirection, int damageAmount, bool isEnemySpawnerDamageable);
+		
+		/** Remove a bullet. The last bullet of the store takes the removed bullet index, so bullets must be browsed from the last one to the first one when some of them are removed.
+		 * @param index The bullet index.
+		 */
+		void removeBullet(int index);
+		
+		/** Remove all bullets. */
+		inline void clear()
+		{
+			_bulletsCount = 0;
+		}
+		
+		/** Get how many bullets the store contains.
+		 * @return The bullets amount.
+		 */
+		inline int getBulletsCount()
+		{
+			return _bulletsCount;
+		}
+		
+		/** Move all bullets at their speed and check them against the scene walls. A bullet can't go through a wall, whatever its speed is.
+		 * @warning This function does not check against enemy or player collision, use getCrossedRectangle() to find the entities a bullet hit.
+		 */
+		void update();
+		
+		/** Tell whether a bullet must be destroyed after the last update.
+		 * @param index The bullet index.
+		 * @return false if the bullet is still flying,
+		 * @return true if the bullet hit a wall or traveled its maximum distance.
+		 */
+		inline bool isDestroyed(int index)
+		{
+			return _isDestroyed[index];
+		}
+		
+		/** Get a bullet X coordinate.
+		 * @param index The bullet index.
+		 * @return The X coordinate.
+		 */
+		inline int getX(int index)
+		{
+			return _positionsX[index];
+		}
+		
+		/** Get a bullet Y coordinate.
+		 * @param index The bullet index.
+		 * @return The Y coordinate.
+		 */
+		inline int getY(int index)
+		{
+			return _positionsY[index];
+		}
+		
+		/** How many life points a bullet removes.
+		 * @param index The bullet index.
+		 * @return Life points to ADD to hit entity (the value is negative yet to directly use with modifyLife() functions).
+		 */
+		inline int getDamageAmount(int index)
+		{
+			return _damageAmounts[index];
+		}
+		
+		/** Get a bullet moving direction.
+		 * @param index The bullet index.
+		 * @return The direction.
+		 */
+		inline MovingEntity::Direction getDirection(int index)
+		{
+			return _directions[index];
+		}
+		
+		/** Get a rectangle defining a bullet bounds in the map.
+		 * @param index The bullet index.
+		 * @param pointerPositionRectangle On output, contain the bullet position rectangle.
+		 */
+		void getPositionRectangle(int index, SDL_Rect *pointerPositionRectangle);
+		
+		/** Get the whole area a bullet went through during the last update, from its previous position to its current one. An entity overlapping this area has been hit, even if the bullet is faster than the entity size.
+		 * @param index The bullet index.
+		 * @param pointerCrossedRectangle On output, contain the crossed area.
+		 */
+		void getCrossedRectangle(int index, SDL_Rect *pointerCrossedRectangle);
+		
+		/** Move a bullet back to the position it had when it touched a rectangle during the last update, so the bullet explodes on the hit entity side instead of beyond it.
+		 * @param index The bullet index.
+		 * @param pointerHitRectangle The hit entity position rectangle. It must overlap the bullet crossed area.
+		 */
+		void moveToHitPosition(int index, const SDL_Rect *pointerHitRectangle);
+		
+		/** Record all bullets to the snapshot being recorded. */
+		void addToSnapshot();
+		
+	private:
+		/** How many bullets are stored. */
+		int _bulletsCount;
+		
+		/** All bullets X coordinate. */
+		int _positionsX[CONFIGURATION_BULLET_MAXIMUM_COUNT];
+		/** All bullets Y coordinate. */
+		int _positionsY[CONFIGURATION_BULLET_MAXIMUM_COUNT];
+		/** All bullets X coordinate before the last update, used to interpolate the rendering position. */
+		int _previousPositionsX[CONFIGURATION_BULLET_MAXIMUM_COUNT];
+		/** All bullets Y coordinate before the last update, used to interpolate the rendering position. */
+		int _previousPositionsY[CONFIGURATION_BULLET_MAXIMUM_COUNT];
+		/** All bullets width in pixels. */
+		int _widths[CONFIGURATION_BULLET_MAXIMUM_COUNT];
+		/** All bullets height in pixels. */
+		int _heights[CONFIGURATION_BULLET_MAXIMUM_COUNT];
+		
+		/** All bullets moving direction. */
+		MovingEntity::Direction _directions[CONFIGURATION_BULLET_MAXIMUM_COUNT];
+		/** All bullets horizontal moving direction (-1 to go to left, 1 to go to right, 0 to stay on the same column). */
+		int _directionsX[CONFIGURATION_BULLET_MAXIMUM_COUNT];
+		/** All bullets vertical moving direction (-1 to go to up, 1 to go to down, 0 to stay on the same row). */
+		int _directionsY[CONFIGURATION_BULLET_MAXIMUM_COUNT];
+		/** All bullets speed in pixels. */
+		int _movingPixelsAmounts[CONFIGURATION_BULLET_MAXIMUM_COUNT];
+		/** How many pixels each bullet can move during the current update without entering a wall. */
+		int _allowedMovingPixelsAmounts[CONFIGURATION_BULLET_MAXIMUM_COUNT];
+		/** How many distance each bullet traveled. */
+		int _movedDistances[CONFIGURATION_BULLET_MAXIMUM_COUNT];
+		
+		/** All bullets damage amount (the value is negative). */
+		int _damageAmounts[CONFIGURATION_BULLET_MAXIMUM_COUNT];
+		/** The block content bit mask each bullet collides with. */
+		int _collisionBlockContents[CONFIGURATION_BULLET_MAXIMUM_COUNT];
+		/** Tell which bullets must be destroyed after the last update. */
+		bool _isDestroyed[CONFIGURATION_BULLET_MAXIMUM_COUNT];
+		
+		/** All bullets texture (in the bullet moving direction). */
+		Texture *_pointerTextures[CONFIGURATION_BULLET_MAXIMUM_COUNT];
+};
+
+#endif
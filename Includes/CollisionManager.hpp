@@ -0,0 +1,61 @@
+/** @file CollisionManager.hpp
+ * Store the entities that bullets can hit in grids made of level blocks, so a bullet only needs to be checked against the entities located around it.
+ * @author Adrien RICCIARDI
+ */
+#ifndef HPP_COLLISION_MANAGER_HPP
+#define HPP_COLLISION_MANAGER_HPP
+
+#include <Entity.hpp>
+#include <MovingEntity.hpp>
+#include <SDL2/SDL.h>
+
+namespace CollisionManager
+{
+	/** All available grids. */
+	typedef enum
+	{
+		GRID_ID_ENEMIES,
+		GRID_ID_ENEMY_SPAWNERS,
+		GRID_IDS_COUNT
+	} GridId;
+
+	/** Store an entity in the grid cell containing the entity top left corner.
+	 * @param gridId The grid to add the entity to.
+	 * @param pointerEntity The entity to add. It must not be bigger than a level block.
+	 */
+	void addEntity(GridId gridId, Entity *pointerEntity);
+
+	/** Remove an entity from the grid it is stored in. Nothing is done if the entity is not stored in a grid.
+	 * @param pointerEntity The entity to remove.
+	 */
+	void removeEntity(Entity *pointerEntity);
+
+	/** Move an entity to the right grid cell after its coordinates changed. This is fast when the entity stays in the same cell.
+	 * @param pointerEntity The entity that moved. It must have been added to a grid before.
+	 */
+	void updateEntity(Entity *pointerEntity);
+
+	/** Remove all entities from all grids at once. The entities are not modified, so they must not be used anymore.
+	 * @note This is intended to be used when a level is left, when all entities are released at once without calling their destructors.
+	 */
+	void clear();
+
+	/** Find an entity which collides with the provided rectangle.
+	 * @param gridId The grid to search entities into.
+	 * @param pointerRectangle The rectangle to check entities against.
+	 * @return NULL if no entity collides with the rectangle,
+	 * @return a valid pointer on the first found colliding entity.
+	 */
+	Entity *getCollidingEntity(GridId gridId, SDL_Rect *pointerRectangle);
+
+	/** Find the entity a moving object met first when it went through an area. All cells covered by the area are checked, so the area can span many blocks.
+	 * @param gridId The grid to search entities into.
+	 * @param pointerRectangle The area the object went through (see BulletStore::getCrossedRectangle()).
+	 * @param direction The direction the object moved to.
+	 * @return NULL if no entity collides with the area,
+	 * @return a valid pointer on the colliding entity which is the closest to the area starting side.
+	 */
+	Entity *getFirstCollidingEntity(GridId gridId, SDL_Rect *pointerRectangle, MovingEntity::Direction direction);
+}
+
+#endif
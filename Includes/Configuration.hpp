@@ -19,8 +19,22 @@
 #define CONFIGURATION_DISPLAY_WIDTH 1024
 /** Display height in pixels (only in windowed mode). */
 #define CONFIGURATION_DISPLAY_HEIGHT 768
-/** Display refresh period (for a 60Hz refresh frequency, the period is 1/60 = 0.016ms). */
+/** Full screen display height in pixels. The game is rendered at this height (the width follows the screen aspect ratio), then upscaled to the screen resolution by the graphics hardware, so high resolution screens do not display more of the level or need more rendering work. Screens smaller than this height are used at their native resolution. */
+#define CONFIGURATION_DISPLAY_FULL_SCREEN_LOGICAL_HEIGHT 768
+/** Set to 1 to upscale the full screen display by an integer factor only (the rendering height is the largest one that is a divisor of the screen height while being greater or equal to CONFIGURATION_DISPLAY_FULL_SCREEN_LOGICAL_HEIGHT), so pixels keep a sharp square shape. Set to 0 to scale the display to fill the screen. */
+#define CONFIGURATION_DISPLAY_IS_INTEGER_UPSCALING_ENABLED 0
+/** The filtering used to upscale the full screen display ("nearest" or "linear"). Linear filtering looks smoother but can make textures packed in an atlas bleed on their neighbors. */
+#define CONFIGURATION_DISPLAY_UPSCALING_QUALITY "nearest"
+/** Display refresh period (for a 60Hz refresh frequency, the period is 1/60 = 0.016ms). It is used to limit the frame rate only when vertical synchronization is not available. */
 #define CONFIGURATION_DISPLAY_REFRESH_PERIOD_MILLISECONDS 16
+/** When nothing moves on the display (a menu is displayed or the game is over), the same picture is not displayed again, the game waits for an event instead. The display is still refreshed after this time (in milliseconds) in case an expected event is missed. */
+#define CONFIGURATION_DISPLAY_IDLE_EVENT_WAITING_TIMEOUT_MILLISECONDS 500
+/** Textures are packed in atlases of this width and height in pixels, so the renderer does not need to switch textures often (a smaller size is used if the renderer does not support it). Textures too big to fit in an atlas keep their own texture. */
+#define CONFIGURATION_DISPLAY_TEXTURE_ATLAS_SIZE 2048
+/** The width in pixels of the texture all font characters are rasterized to. Its height depends on the fonts size. */
+#define CONFIGURATION_DISPLAY_GLYPHS_ATLAS_WIDTH 512
+/** How many textures can be queued in the sprite batch before it is displayed. Consecutive textures coming from the same SDL texture are displayed all at once. */
+#define CONFIGURATION_DISPLAY_SPRITE_BATCH_MAXIMUM_TEXTURES_COUNT 4096
 /** HUD background texture screen X coordinate. */
 #define CONFIGURATION_DISPLAY_HUD_BACKGROUND_TEXTURE_X 10
 /** HUD background texture screen Y coordinate. */
@@ -47,6 +61,10 @@
 // Menu
 /** Maximum amount of items that a single menu can display. */
 #define CONFIGURATION_MENU_MAXIMUM_ITEMS_COUNT 5
+/** Maximum size in bytes (including the terminating zero) of a menu title or item string. */
+#define CONFIGURATION_MENU_MAXIMUM_STRING_SIZE 64
+/** How many different menus keep their rendered strings, so they are displayed immediately when they are opened again. */
+#define CONFIGURATION_MENU_CACHED_PAGES_COUNT 8
 /** Menu vertical space (in pixels) between two item strings. */
 #define CONFIGURATION_MENU_ITEM_STRINGS_VERTICAL_SPACING 60
 /** Menu title vertical coordinate. */
@@ -78,8 +96,16 @@
 #define CONFIGURATION_LEVEL_BLOCK_SIZE 64
 /** How many levels are available. */
 #define CONFIGURATION_LEVELS_COUNT 7
+/** The scene is pre-rendered in square chunks of this size (in blocks), so only a few textures are displayed each frame. */
+#define CONFIGURATION_LEVEL_SCENE_CHUNK_SIZE 8
+/** How many bytes are reserved for the objects that live until the level is left (bigger allocations are done from the heap). */
+#define CONFIGURATION_LEVEL_ARENA_SIZE (1024 * 1024)
 
 // Gameplay
+/** The game logic is updated at this fixed period (in milliseconds) whatever the display refresh rate is. All entities speeds and game timers are expressed in game ticks, so changing this value changes the game speed. */
+#define CONFIGURATION_GAMEPLAY_TICK_PERIOD_MILLISECONDS 16
+/** How many late game ticks the game logic thread can simulate in a row. When the computer is too slow to keep up, the game is slowed down instead of never publishing a snapshot to display. */
+#define CONFIGURATION_GAMEPLAY_MAXIMUM_TICKS_PER_FRAME 5
 /** The probability (in range 0% to 100%) to spawn a medipack when an enemy dies. */
 #define CONFIGURATION_GAMEPLAY_MEDIPACK_ITEM_SPAWN_PROBABILITY_PERCENTAGE 10
 /** The probability (in range 0% to 100%) to spawn ammunition when an enemy dies. */
@@ -108,6 +134,32 @@
 /** Joystick analog parts threshold to consider the part is pushed (must be in range [0..32767] according to SDL documentation). */
 #define CONFIGURATION_GAMEPLAY_JOYSTICK_ANALOG_THRESHOLD 25000
 
+// Headless mode
+/** How many game logic updates are simulated on each level when the game is run in headless mode. */
+#define CONFIGURATION_HEADLESS_TICKS_PER_LEVEL 20000
+
+// Object pools
+/** How many small enemies can be stored in their pool before the level arena is used. */
+#define CONFIGURATION_OBJECT_POOL_SMALL_ENEMIES_COUNT 512
+/** How many medium enemies can be stored in their pool before the level arena is used. */
+#define CONFIGURATION_OBJECT_POOL_MEDIUM_ENEMIES_COUNT 256
+/** How many big enemies can be stored in their pool before the level arena is used. */
+#define CONFIGURATION_OBJECT_POOL_BIG_ENEMIES_COUNT 128
+/** How many enemy spawners can be stored in their pool before the level arena is used. */
+#define CONFIGURATION_OBJECT_POOL_ENEMY_SPAWNERS_COUNT 256
+/** How many effects can be displayed at the same time before the level arena is used. */
+#define CONFIGURATION_OBJECT_POOL_EFFECTS_COUNT 512
+/** How many animated textures can be stored in their pool before the level arena is used (each effect and each enemy spawner owns an animated texture). */
+#define CONFIGURATION_OBJECT_POOL_ANIMATED_TEXTURES_COUNT (CONFIGURATION_OBJECT_POOL_EFFECTS_COUNT + CONFIGURATION_OBJECT_POOL_ENEMY_SPAWNERS_COUNT)
+
+// Worker pool
+/** The maximum amount of worker threads helping the game logic thread. Less threads are started on a computer with less processor cores. */
+#define CONFIGURATION_WORKER_POOL_MAXIMUM_THREADS_COUNT 7
+/** Below this items count, a parallel loop is run by the calling thread only, because waking the worker threads up would cost more than it saves. */
+#define CONFIGURATION_WORKER_POOL_MINIMUM_PARALLEL_ITEMS_COUNT 64
+/** How many consecutive items a thread takes at once from a parallel loop. */
+#define CONFIGURATION_WORKER_POOL_ITEMS_CHUNK_SIZE 16
+
 // Savegame
 /** The savegame file. */
 #define CONFIGURATION_SAVEGAME_FILE_NAME "Savegame.txt"
@@ -131,6 +183,8 @@
 #define CONFIGURATION_PLAYER_MUZZLE_FLASH_MORTAR_SHELL_FACING_RIGHT_STARTING_POSITION_OFFSET_Y 4
 
 // Bullet entities
+/** How many bullets can be flying at the same time (the player bullets and the enemies bullets are counted separately). */
+#define CONFIGURATION_BULLET_MAXIMUM_COUNT 4096
 /** The offset to add to the bullet X and Y positions (whatever direction the bullet is facing) when adding a bullet explosion effect. */
 #define CONFIGURATION_BULLET_EXPLOSION_POSITION_OFFSET (-20)
 
@@ -66,7 +66,7 @@ namespace EffectManager
 	*/
 	void addEffect(int x, int y, EffectId effectId, int soundSourceAngle = 0, int soundSourceDistance = 0);
 
-	/** Delete all currently playing effects. */
+	/** Forget all currently playing effects without deleting them, their memory is released with all other level objects (see ObjectPoolBase::resetAll()). */
 	void clearAllEffects();
 
 	/** Update all currently playing effects state.
@@ -74,10 +74,10 @@ namespace EffectManager
 	*/
 	void update();
 
-	/** Display all currently playing effects.
-	* @note Must be called on the game rendering step.
+	/** Record all currently playing effects to the snapshot being recorded.
+	* @note Must be called when the game tick snapshot is recorded.
 	*/
-	void render();
+	void addToSnapshot();
 }
 
 #endif
@@ -48,7 +48,12 @@ class EnemyFightingEntity: public FightingEntity
 		// No need for documentation because it is the same as parent function
 		virtual int moveToRight();
 		
-		/** Update enemy artificial intelligence.
+		/** Choose what the enemy will do during this game tick. Only the enemy's own _decision, _decidedDirection and _decidedFacingDirection are written, the level, the player and the other enemies are only read, so all enemies can decide at the same time on different threads.
+		 * @note Player paths must have been updated for this game tick before calling this function.
+		 */
+		void decide();
+		
+		/** Carry out the action chosen by decide(). Enemies must be updated one after the other, so the first enemy to enter a block is always the same one.
 		 * @return 0 if the enemy must be kept alive,
 		 * @return 1 if the enemy is dead and must be removed,
 		 * @return 2 if the enemy is alive and wants to shoot (call the shoot() method).
@@ -56,7 +61,7 @@ class EnemyFightingEntity: public FightingEntity
 		virtual int update();
 		
 		// No need for documentation because it is the same as parent function
-		virtual void render();
+		virtual void addToSnapshot();
 
 	protected:
 		/** The player will be spotted by the enemy if he enters this area. */
@@ -74,7 +79,24 @@ class EnemyFightingEntity: public FightingEntity
 		EffectManager::EffectId _explosionEffectId;
 
 	private:
-		/** Tell if the enemy can shoot the player or not.
+		/** All actions an enemy can choose to do during a game tick. */
+		typedef enum
+		{
+			DECISION_STAY,
+			DECISION_DIE,
+			DECISION_SHOOT,
+			DECISION_FOLLOW_PLAYER_PATH,
+			DECISION_MOVE_TO_PLAYER
+		} Decision;
+		
+		/** The action chosen by the last decide() call. */
+		Decision _decision;
+		/** The direction to move to, when the decision requires moving. */
+		Direction _decidedDirection;
+		/** The direction the enemy will face before carrying out the decision (the enemy turns to the player when the player enters a shooting rectangle). */
+		Direction _decidedFacingDirection;
+		
+		/** Tell if the enemy can shoot the player or not. If the player is in a shooting rectangle the enemy is not facing, the decided facing direction is set to face the player.
 		 * @return 1 if the enemy can shoot,
 		 * @return 0 if the player is out of range.
 		 */
@@ -87,6 +109,14 @@ class EnemyFightingEntity: public FightingEntity
 		 */
 		int _getPlayerDirection(Direction *pointerDirection);
 		
+		/** Tell in which direction to go to fit in the current block row or column, so the enemy can enter the next block without being stopped by a wall corner.
+		 * @param movingDirection The direction the enemy wants to go to.
+		 * @param pointerDirection On output, contain the direction to go to fit in the block.
+		 * @return 1 if the enemy must move to fit in the block,
+		 * @return 0 if the enemy already fits in the block.
+		 */
+		int _getBlockAlignmentDirection(Direction movingDirection, Direction *pointerDirection);
+		
 		/** Set or reset a block flag telling whether an enemy is present on the block.
 		 * @param isEnemyPresent Set to true to set the flag, set to false to reset the flag.
 		 */
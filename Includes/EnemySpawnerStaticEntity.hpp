@@ -22,6 +22,17 @@ class EnemySpawnerStaticEntity: public StaticEntity
 		// No need for documentation because it is the same as parent function
 		virtual ~EnemySpawnerStaticEntity();
 		
+		/** Take the enemy spawner memory from a pool instead of the heap.
+		 * @param size The enemy spawner size in bytes.
+		 * @return The enemy spawner memory.
+		 */
+		static void *operator new(size_t size);
+		
+		/** Give the enemy spawner memory back to its pool.
+		 * @param pointerObject The enemy spawner memory.
+		 */
+		static void operator delete(void *pointerObject);
+		
 		/** Change entity life value by adding or removing some life points.
 		 * @param lifePointsAmount How many life points to add or subtract.
 		 */
@@ -34,7 +45,7 @@ class EnemySpawnerStaticEntity: public StaticEntity
 		}
 		
 		// No need for documentation because it is the same as parent function
-		virtual void render();
+		virtual void addToSnapshot();
 		
 		/** Handle only spawner life state.
 		 * @return 0 if the spawner must be kept,
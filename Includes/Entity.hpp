@@ -45,6 +45,14 @@ class Entity
 		 * @return The position rectangle.
 		 */
 		virtual SDL_Rect *getPositionRectangle() = 0;
+		
+		// Collision grid bookkeeping, only CollisionManager is allowed to modify these variables
+		/** The previous entity stored in the same collision grid cell. */
+		Entity *pointerPreviousCollisionGridEntity = NULL;
+		/** The next entity stored in the same collision grid cell. */
+		Entity *pointerNextCollisionGridEntity = NULL;
+		/** The collision grid cell the entity is stored in, or -1 if the entity is not stored in any collision grid. */
+		int collisionGridCellIndex = -1;
 };
 
 #endif
@@ -4,7 +4,7 @@
 #ifndef HPP_FIGHTING_ENTITY_HPP
 #define HPP_FIGHTING_ENTITY_HPP
 
-#include <BulletMovingEntity.hpp>
+#include <BulletStore.hpp>
 #include <EffectManager.hpp>
 #include <MovingEntity.hpp>
 #include <SDL2/SDL.h>
@@ -90,11 +90,12 @@ class FightingEntity: public MovingEntity
 			return false;
 		}
 		
-		/** Generate a bullet facing the entity direction and play the associated effect.
-		 * @return A valid pointer if the entity was allowed to shot,
-		 * @return NULL if the entity could not shoot (no more ammunition, slower fire rate...).
+		/** Fire a bullet facing the entity direction and play the associated effect.
+		 * @param pointerBulletStore The store to add the bullet to.
+		 * @return true if the entity was allowed to shoot,
+		 * @return false if the entity could not shoot (no more ammunition, slower fire rate...).
 		 */
-		virtual BulletMovingEntity *shoot();
+		virtual bool shoot(BulletStore *pointerBulletStore);
 
 	protected:
 		/** How many life points the entity owns. */
@@ -116,12 +117,12 @@ class FightingEntity: public MovingEntity
 		/** The effect to play when the entity shoots. */
 		EffectManager::EffectId _firingEffectId;
 		
-		/** Generate a bullet from the type the enemy fires.
+		/** Fire a bullet from the type the entity fires.
+		 * @param pointerBulletStore The store to add the bullet to.
 		 * @param x Bullet X coordinate.
 		 * @param y Bullet Y coordinate.
-		 * @return An enemy-specific bullet.
 		 */
-		virtual BulletMovingEntity *_fireBullet(int x, int y) = 0;
+		virtual void _fireBullet(BulletStore *pointerBulletStore, int x, int y) = 0;
 		
 		/** Compute the offset to entity coordinates to spawn a bullet at the cannon location for each entity direction.
 		 * @param pointerEntityTexture The entity texture (all textures must have the same dimensions in all entity directions).
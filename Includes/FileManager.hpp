@@ -5,6 +5,8 @@
 #ifndef HPP_FILE_MANAGER_HPP
 #define HPP_FILE_MANAGER_HPP
 
+#include <cstddef>
+
 namespace FileManager
 {
 	/** Retrieve the game base directory.
@@ -18,6 +20,20 @@ namespace FileManager
 	* @return A static string containing the file absolute path.
 	*/
 	const char *getFilePath(const char *pointerStringFileName);
+
+	/** Map a whole file to memory in read-only mode. Only the accessed parts of the file are read from the storage, and nothing is copied on platforms supporting memory-mapped files (the file content is simply loaded to memory on other platforms).
+	* @param pointerStringFilePath The file path (it must have been built with getFilePath()).
+	* @param pointerFileSize On output, contain the file size in bytes.
+	* @return NULL if the file could not be mapped (the reason is logged),
+	* @return a pointer on the file content on success.
+	*/
+	const void *mapFile(const char *pointerStringFilePath, size_t *pointerFileSize);
+
+	/** Release a file mapped by mapFile().
+	* @param pointerFileContent The value returned by mapFile().
+	* @param fileSize The file size returned by mapFile().
+	*/
+	void unmapFile(const void *pointerFileContent, size_t fileSize);
 }
 
 #endif
@@ -26,11 +26,28 @@ namespace HeadUpDisplay
 		COMPASS_ARROW_IDS_COUNT
 	} CompassArrowId;
 
-	/** Cache needed textures.
-	* @return Always 0 as it can't fail.
+	/** All values displayed by the HUD. */
+	typedef struct
+	{
+		int lifePointsAmount; //!< The player life points.
+		int maximumLifePointsAmount; //!< The player maximum life points.
+		int ammunitionAmount; //!< The player ammunition.
+		int enemiesAmount; //!< How many enemies are alive.
+		bool isLevelCleared; //!< Tell whether all enemies are dead and all enemy spawners are destroyed (when the enemies amount was set).
+		MortarState mortarState; //!< The mortar state.
+		int remainingBonusSeconds; //!< How many bonus seconds remain, 0 if no bonus is active.
+		bool isCompassArrowLighted[COMPASS_ARROW_IDS_COUNT]; //!< Tell which compass arrows are lighted.
+	} State;
+
+	/** Cache needed textures and create the texture the HUD is drawn to.
+	* @return 0 on success,
+	* @return -1 if an error occurred.
 	*/
 	int initialize();
 
+	/** Free all allocated resources. */
+	void uninitialize();
+
 	/** Update "enemies count" part of the HUD.
 	* @param amount How many enemies to display.
 	*/
@@ -52,8 +69,15 @@ namespace HeadUpDisplay
 	 */
 	void setCompassArrowState(CompassArrowId id, bool isLighted);
 
-	/** Render the strings with the last provided values to the screen. */
-	void render();
+	/** Get the values the HUD must display. The player life points and ammunition are read from the player.
+	 * @param pointerState On output, contain the last provided values.
+	 */
+	void getState(State *pointerState);
+
+	/** Render the provided values to the screen. The HUD is drawn to a texture, only the parts whose values changed are drawn again, then the texture is displayed at once.
+	 * @param pointerState The values to display.
+	 */
+	void render(const State *pointerState);
 }
 
 #endif
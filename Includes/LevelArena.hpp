@@ -0,0 +1,70 @@
+/** @file LevelArena.hpp
+ * Provide memory to the objects that live until the current level is left. The memory is taken from a big buffer by simply incrementing an offset, and it is all released at once when a level is loaded.
+ * @author Adrien RICCIARDI
+ */
+#ifndef HPP_LEVEL_ARENA_HPP
+#define HPP_LEVEL_ARENA_HPP
+
+#include <cstddef>
+
+namespace LevelArena
+{
+	/** Get some memory that will be valid until the arena is reset. When the arena is full, memory is taken from the heap and it will be freed on arena reset too.
+	 * @param size How many bytes to allocate.
+	 * @return The allocated memory, which is aligned for any type (std::bad_alloc is thrown if the heap is needed and it is full, like operator new() does).
+	 */
+	void *allocate(size_t size);
+	
+	/** Release all allocated memory at once. Objects destructors are not called, so the objects must not own any resource that would need to be freed.
+	 * @note Call this function only when nothing is referencing the arena memory anymore.
+	 */
+	void reset();
+	
+	/** @class Allocator
+	 * Allow standard containers to store their nodes in the arena. Memory given back by a container is not reused until the arena is reset.
+	 */
+	template <typename T>
+	class Allocator
+	{
+		public:
+			/** The allocated type, required by the standard containers. */
+			typedef T value_type;
+			
+			/** Create an allocator. */
+			Allocator() {}
+			
+			/** Create an allocator from an allocator of another type, required by the standard containers.
+			 * @param allocator The allocator to copy (all allocators use the same arena).
+			 */
+			template <typename U>
+			Allocator(const Allocator<U> &) {}
+			
+			/** Allocate memory for some objects.
+			 * @param objectsCount How many objects to allocate.
+			 * @return The objects memory.
+			 */
+			inline T *allocate(size_t objectsCount)
+			{
+				return static_cast<T *>(LevelArena::allocate(objectsCount * sizeof(T)));
+			}
+			
+			/** Nothing to do, memory will be released when the arena is reset. */
+			inline void deallocate(T *, size_t) {}
+	};
+	
+	/** All allocators use the same arena, so memory allocated by an allocator can be deallocated by any other one. */
+	template <typename T, typename U>
+	inline bool operator==(const Allocator<T> &, const Allocator<U> &)
+	{
+		return true;
+	}
+	
+	/** All allocators use the same arena, so memory allocated by an allocator can be deallocated by any other one. */
+	template <typename T, typename U>
+	inline bool operator!=(const Allocator<T> &, const Allocator<U> &)
+	{
+		return false;
+	}
+}
+
+#endif
@@ -0,0 +1,61 @@
+/** @file LevelFile.hpp
+ * The compiled level file format, shared by the game and the level compiler. The level compiler validates the level and precomputes everything the game needs, so a compiled level is loaded by mapping the file to memory and using its content as-is.
+ * The file starts with a header telling where the other parts are located, then comes the scene plane (the texture ID of each block, stored row after row), the walls bitmask, the objects plane (the object ID of each block, stored in the same way) and the list of the enemy spawners coordinates.
+ * @note All values are stored in little endian, like all platforms the game is built for.
+ * @author Adrien RICCIARDI
+ */
+#ifndef HPP_LEVEL_FILE_HPP
+#define HPP_LEVEL_FILE_HPP
+
+#include <cstdint>
+
+namespace LevelFile
+{
+	/** The value of the header magic number field ("SLVL" string). */
+	#define LEVEL_FILE_MAGIC_NUMBER 0x4C564C53
+	/** Increment this value each time the file format is modified, so outdated files are not loaded. */
+	#define LEVEL_FILE_VERSION 2
+
+	/** How many floor textures are available. Scene texture IDs start with the floor textures, then come the wall textures. */
+	#define LEVEL_FILE_SCENE_FLOOR_TEXTURES_COUNT 17
+	/** How many scene textures (floors and walls) are available. */
+	#define LEVEL_FILE_SCENE_TEXTURES_COUNT 24
+
+	/** All available spawnable objects. */
+	typedef enum
+	{
+		OBJECT_ID_PLAYER,
+		OBJECT_ID_MEDIPACK,
+		OBJECT_ID_AMMUNITION,
+		OBJECT_ID_ENEMY_SPAWNER,
+		OBJECT_ID_LEVEL_EXIT,
+		OBJECT_ID_GOLDEN_MEDIPACK,
+		OBJECT_IDS_COUNT
+	} ObjectId;
+
+	/** The file header. All offsets are expressed in bytes from the beginning of the file. */
+	typedef struct
+	{
+		uint32_t magicNumber; //!< Always set to LEVEL_FILE_MAGIC_NUMBER.
+		uint32_t version; //!< The version of the format the file is using.
+		uint16_t widthBlocks; //!< The level width in blocks.
+		uint16_t heightBlocks; //!< The level height in blocks.
+		uint16_t playerX; //!< The player starting block X coordinate.
+		uint16_t playerY; //!< The player starting block Y coordinate.
+		uint32_t enemySpawnersCount; //!< How many enemy spawners the level contains.
+		uint32_t scenePlaneOffset; //!< Where the scene plane is located. This plane contains an int16_t texture ID per block, all IDs are scene texture IDs.
+		uint32_t wallsBitmaskOffset; //!< Where the walls bitmask is located. It contains a bit per block, which is set when the block is a wall (bit 0 of the first byte is the first block).
+		uint32_t objectsPlaneOffset; //!< Where the objects plane is located. This plane contains an int8_t object ID per block, or -1 if there is no object on the block. The player and the enemy spawners are not stored in this plane because their location is directly provided.
+		uint32_t enemySpawnersOffset; //!< Where the enemy spawners list is located.
+		uint32_t fileSize; //!< The whole file size, used to detect truncated files.
+	} Header;
+
+	/** An enemy spawner location. Enemy spawners are stored in the same order than if they were found while browsing the objects plane. */
+	typedef struct
+	{
+		uint16_t x; //!< X coordinate in blocks.
+		uint16_t y; //!< Y coordinate in blocks.
+	} EnemySpawner;
+}
+
+#endif
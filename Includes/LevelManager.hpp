@@ -5,8 +5,12 @@
 #ifndef HPP_LEVEL_MANAGER_HPP
 #define HPP_LEVEL_MANAGER_HPP
 
+#include <cstdint>
 #include <EnemySpawnerStaticEntity.hpp>
+#include <LevelArena.hpp>
 #include <list>
+#include <MovingEntity.hpp>
+#include <vector>
 
 namespace LevelManager
 {
@@ -24,8 +28,26 @@ namespace LevelManager
 		BLOCK_CONTENT_LEVEL_EXIT = 1 << 8 //!< If set and the player walks on it, the game will load the next level.
 	} BlockContent;
 
+	/** A block which displayed content changed. */
+	typedef struct
+	{
+		int blockIndex; //!< The block index in the level.
+		uint16_t content; //!< The new block content.
+	} SceneBlockChange;
+
+	/** All scene changes the game logic made since the previous scene update, so the scene can be displayed by another thread than the game logic one. */
+	typedef struct
+	{
+		bool isLevelChanged; //!< Tell whether a new level has been loaded. The level dimensions and blocks are valid only when this field is true.
+		int widthBlocks; //!< The new level width in blocks.
+		int heightBlocks; //!< The new level height in blocks.
+		std::vector<uint8_t> blocksTextureIds; //!< The new level blocks texture ID.
+		std::vector<uint16_t> blocksContent; //!< The new level blocks content.
+		std::vector<SceneBlockChange> blockChanges; //!< The blocks which displayed content changed, in the order they changed.
+	} SceneUpdate;
+
 	/** Contain all living enemy spawners. */
-	extern std::list<EnemySpawnerStaticEntity *> enemySpawnersList;
+	extern std::list<EnemySpawnerStaticEntity *, LevelArena::Allocator<EnemySpawnerStaticEntity *> > enemySpawnersList;
 
 	/** Prepare all scene blocks.
 	 * @return -1 if an error occurred,
@@ -36,14 +58,32 @@ namespace LevelManager
 	/** Free all allocated resources. */
 	void uninitialize();
 
-	/** Load a level from two Comma Separated Value files (x_Scene.csv and x_Objects.csv, where x is the level number).
+	/** Start decoding a level in the background, so it can be immediately started by loadLevel() when the current level is finished. The current level can be played while the level is preloaded.
+	 * @param levelNumber The level number (starting from 0).
+	 * @note Errors are reported by loadLevel().
+	 */
+	void preloadLevel(int levelNumber);
+
+	/** Load a level from the compiled level file (x_Level.bin, where x is the level number). If this file is missing or outdated, the level is loaded from two Comma Separated Value files (x_Scene.csv and x_Objects.csv). If the level has been preloaded, only the player and the enemy spawners need to be spawned.
 	 * @param levelNumber The level number (starting from 0).
 	 * @return -1 if an error occurred,
 	 * @return 0 if the level was successfully loaded.
 	 */
 	int loadLevel(int levelNumber);
 
-	/** Display the scene (decor) to the main renderer.
+	/** Get all scene changes made since this function was last called.
+	 * @param pointerSceneUpdate On output, contain the scene changes. The update vectors memory is reused.
+	 * @note Must be called by the game logic thread.
+	 */
+	void getSceneUpdate(SceneUpdate *pointerSceneUpdate);
+
+	/** Apply scene changes to the displayed scene. The update is emptied, so it can't be applied twice.
+	 * @param pointerSceneUpdate The scene changes.
+	 * @note Must be called by the rendering thread.
+	 */
+	void applySceneUpdate(SceneUpdate *pointerSceneUpdate);
+
+	/** Display the scene (decor) to the main renderer. The displayed scene is the one provided by the last applied scene update.
 	 * @param topLeftX This is the scene horizontal coordinate to start drawing from.
 	 * @param topLeftY This is the scene vertical coordinate to start drawing from.
 	 */
@@ -53,7 +93,7 @@ namespace LevelManager
 	 * @param x Point x coordinate in pixels.
 	 * @param y Point y coordinate in pixels.
 	 * @param blockContent The type of block to check (wall, enemy spawner...). Block types can be ORed to check multiple blocks at a time.
-	 * @return The distance in pixels. To be faster, the functions stops if the first searched block is further than CONFIGURATION_LEVEL_BLOCK_SIZE pixels.
+	 * @return The distance in pixels. Walls and enemy spawners are found however far they are, thanks to precomputed distances, but enemies and other block contents are searched in the next block only (the returned distance is at least CONFIGURATION_LEVEL_BLOCK_SIZE pixels if the next block is free).
 	 */
 	int getDistanceFromUpperBlock(int x, int y, int blockContent);
 
@@ -61,7 +101,7 @@ namespace LevelManager
 	 * @param x Point x coordinate in pixels.
 	 * @param y Point y coordinate in pixels.
 	 * @param blockContent The type of block to check (wall, enemy spawner...). Block types can be ORed to check multiple blocks at a time.
-	 * @return The distance in pixels. To be faster, the functions stops if the first searched block is further than CONFIGURATION_LEVEL_BLOCK_SIZE pixels.
+	 * @return The distance in pixels. Walls and enemy spawners are found however far they are, thanks to precomputed distances, but enemies and other block contents are searched in the next block only (the returned distance is at least CONFIGURATION_LEVEL_BLOCK_SIZE pixels if the next block is free).
 	 */
 	int getDistanceFromDownerBlock(int x, int y, int blockContent);
 
@@ -69,7 +109,7 @@ namespace LevelManager
 	 * @param x Point x coordinate in pixels.
 	 * @param y Point y coordinate in pixels.
 	 * @param blockContent The type of block to check (wall, enemy spawner...). Block types can be ORed to check multiple blocks at a time.
-	 * @return The distance in pixels. To be faster, the functions stops if the first searched block is further than CONFIGURATION_LEVEL_BLOCK_SIZE pixels.
+	 * @return The distance in pixels. Walls and enemy spawners are found however far they are, thanks to precomputed distances, but enemies and other block contents are searched in the next block only (the returned distance is at least CONFIGURATION_LEVEL_BLOCK_SIZE pixels if the next block is free).
 	 */
 	int getDistanceFromLeftmostBlock(int x, int y, int blockContent);
 
@@ -77,7 +117,7 @@ namespace LevelManager
 	 * @param x Point x coordinate in pixels.
 	 * @param y Point y coordinate in pixels.
 	 * @param blockContent The type of block to check (wall, enemy spawner...). Block types can be ORed to check multiple blocks at a time.
-	 * @return The distance in pixels. To be faster, the functions stops if the first searched block is further than CONFIGURATION_LEVEL_BLOCK_SIZE pixels.
+	 * @return The distance in pixels. Walls and enemy spawners are found however far they are, thanks to precomputed distances, but enemies and other block contents are searched in the next block only (the returned distance is at least CONFIGURATION_LEVEL_BLOCK_SIZE pixels if the next block is free).
 	 */
 	int getDistanceFromRightmostBlock(int x, int y, int blockContent);
 
@@ -99,6 +139,21 @@ namespace LevelManager
 	 */
 	bool isObstaclePresentOnHorizontalAxis(int leftmostX, int rightmostX, int y);
 
+	/** Compute the shortest way to the player from every level block, so all enemies can find their way to the player without searching it. Nothing is computed if the player did not change block since the previous call and no obstacle appeared or disappeared.
+	 * @param playerX The player center X coordinate in pixels.
+	 * @param playerY The player center Y coordinate in pixels.
+	 */
+	void updatePlayerPaths(int playerX, int playerY);
+
+	/** Tell which way to go from a block to reach the player. The ways are the ones computed by the last updatePlayerPaths() call.
+	 * @param x X coordinate in pixels.
+	 * @param y Y coordinate in pixels.
+	 * @param pointerDirection On output, contain the direction to go to reach the next block of the way. It is not set when the block is the player one or when the player can't be reached.
+	 * @return -1 if the player can't be reached from this block,
+	 * @return the distance in blocks to the player (0 means the block is the player one).
+	 */
+	int getPlayerPathDirection(int x, int y, MovingEntity::Direction *pointerDirection);
+
 	/** Get a block content.
 	 * @param x X coordinate in pixels.
 	 * @param y Y coordinate in pixels.
@@ -60,6 +60,16 @@ class MovingEntity: public Entity
 		 */
 		virtual SDL_Rect *getPositionRectangle();
 		
+		/** Get the X coordinate the entity had when the last game tick started.
+		 * @return The X coordinate in the map.
+		 */
+		int getPreviousX();
+		
+		/** Get the Y coordinate the entity had when the last game tick started.
+		 * @return The Y coordinate in the map.
+		 */
+		int getPreviousY();
+		
 		/** Move the entity to the up.
 		 * @return How many pixels the entity moved.
 		 */
@@ -98,8 +108,8 @@ class MovingEntity: public Entity
 		/** Turn the entity to the right direction. */
 		void turnToRight();
 		
-		/** Display the texture facing in the right direction. */
-		virtual void render();
+		/** Record the texture facing in the right direction to the snapshot being recorded, with the position the entity had when the game tick started so it can be interpolated. */
+		virtual void addToSnapshot();
 		
 	protected:
 		/** Tell in which direction the entity is facing. */
@@ -115,6 +125,16 @@ class MovingEntity: public Entity
 		Texture *_pointerTextures[DIRECTIONS_COUNT];
 		/** All entity collision rectangles (one for each direction). */
 		SDL_Rect _positionRectangles[DIRECTIONS_COUNT];
+		
+		/** The entity X coordinate at the beginning of the game tick it last moved in. */
+		int _previousX;
+		/** The entity Y coordinate at the beginning of the game tick it last moved in. */
+		int _previousY;
+		/** The simulation time of the game tick the entity last moved in. */
+		unsigned int _previousPositionTime;
+		
+		/** Store the entity position before it moves for the first time during the current game tick, so the rendering can be interpolated between two game ticks. */
+		void _storePreviousPosition();
 };
 
 #endif
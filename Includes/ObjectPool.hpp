@@ -0,0 +1,168 @@
+/** @file ObjectPool.hpp
+ * @author Adrien RICCIARDI
+ */
+#ifndef HPP_OBJECT_POOL_HPP
+#define HPP_OBJECT_POOL_HPP
+
+#include <cassert>
+#include <cstddef>
+#include <LevelArena.hpp>
+#include <Log.hpp>
+#include <type_traits>
+
+/** @class ObjectPoolBase
+ * The part of all object pools that does not depend on the stored objects type. All pools are chained together, so their statistics can be displayed at once and they can be all reset when a level is left.
+ */
+class ObjectPoolBase
+{
+	public:
+		/** Log how much all pools have been used since the program started, which allows to tune the pools slots count. */
+		static void logStatistics();
+		
+		/** Release the memory of all objects of all pools at once, without calling the objects destructors.
+		 * @note Pools store only objects living until the level is left, so this must be called when the level objects are not referenced anymore (the level arena must be reset at the same time).
+		 */
+		static void resetAll();
+	
+	protected:
+		/** Add the pool to the pools list.
+		 * @param pointerStringName The pool name, displayed in the statistics.
+		 * @param slotsCount How many objects the pool can store.
+		 */
+		ObjectPoolBase(const char *pointerStringName, int slotsCount);
+		
+		/** Release all objects memory at once. */
+		virtual void _reset() = 0;
+		
+		/** The pool name. */
+		const char *_pointerStringName;
+		/** How many objects the pool can store. */
+		int _slotsCount;
+		
+		/** How many slots are storing an object. */
+		int _usedSlotsCount;
+		/** The highest value reached by _usedSlotsCount. */
+		int _maximumUsedSlotsCount;
+		/** How many objects had to be allocated from the level arena because the pool was full. */
+		int _arenaAllocationsCount;
+	
+	private:
+		/** The first pool of the pools list. */
+		static ObjectPoolBase *_pointerFirstPool;
+		/** The next pool of the pools list. */
+		ObjectPoolBase *_pointerNextPool;
+};
+
+/** @class ObjectPool
+ * Provide the memory of level objects that are often created and destroyed during the game, so no memory is allocated from the heap while playing. All slots are allocated with the pool, and freed slots are chained in a list to be reused immediately.
+ * The pool is meant to be used from the class operator new() and operator delete(), so objects are directly constructed into a pool slot by a regular new expression and they can still be destroyed using a pointer on a parent class.
+ * @note When all slots are used, memory is taken from the level arena so the game keeps working.
+ */
+template <typename T, int SlotsCount>
+class ObjectPool: public ObjectPoolBase
+{
+	public:
+		/** Create an empty pool.
+		 * @param pointerStringName The pool name, displayed in the statistics.
+		 */
+		ObjectPool(const char *pointerStringName): ObjectPoolBase(pointerStringName, SlotsCount)
+		{
+			_reset();
+		}
+		
+		/** Get the memory to construct a new object into.
+		 * @param size The object size in bytes, as provided to operator new().
+		 * @return The object memory.
+		 */
+		void *allocate(size_t size)
+		{
+			Slot *pointerSlot;
+			
+			// An object bigger than a slot can't be stored in the pool, this can happen if a child class inherits the pool operators
+			assert(size <= sizeof(Slot));
+			
+			// Reuse the most recently freed slot, it is likely to be still in the processor cache
+			if (_pointerFirstFreeSlot != NULL)
+			{
+				pointerSlot = _pointerFirstFreeSlot;
+				_pointerFirstFreeSlot = pointerSlot->pointerNextFreeSlot;
+			}
+			// Take a slot that has never been used since the last reset
+			else if (_unusedSlotsIndex < SlotsCount)
+			{
+				pointerSlot = &_slots[_unusedSlotsIndex];
+				_unusedSlotsIndex++;
+			}
+			// Use the level arena when the pool is full
+			else
+			{
+				LOG_DEBUG("Object pool \"%s\" is full, allocating from the level arena.", _pointerStringName);
+				_arenaAllocationsCount++;
+				return LevelArena::allocate(size);
+			}
+			
+			// Update statistics
+			_usedSlotsCount++;
+			if (_usedSlotsCount > _maximumUsedSlotsCount) _maximumUsedSlotsCount = _usedSlotsCount;
+			
+			return pointerSlot;
+		}
+		
+		/** Give back the memory of a destroyed object.
+		 * @param pointerObject The memory returned by allocate(). The object destructor must have already been called (operator delete() is called after the destructor).
+		 */
+		void release(void *pointerObject)
+		{
+			Slot *pointerSlot = static_cast<Slot *>(pointerObject);
+			
+			// Memory taken from the level arena will be released when the level is left
+			if ((pointerSlot < &_slots[0]) || (pointerSlot >= &_slots[SlotsCount])) return;
+			
+			pointerSlot->pointerNextFreeSlot = _pointerFirstFreeSlot;
+			_pointerFirstFreeSlot = pointerSlot;
+			_usedSlotsCount--;
+		}
+		
+		/** Tell how many slots are currently storing an object.
+		 * @return The used slots count.
+		 */
+		inline int getUsedSlotsCount()
+		{
+			return _usedSlotsCount;
+		}
+		
+		/** Tell how many slots have been used at the same time since the pool creation (this is the pool high-water mark).
+		 * @return The maximum used slots count.
+		 */
+		inline int getMaximumUsedSlotsCount()
+		{
+			return _maximumUsedSlotsCount;
+		}
+	
+	protected:
+		// No need for documentation because it is the same as parent function
+		virtual void _reset()
+		{
+			// Slots located after _unusedSlotsIndex do not need to be chained in the free slots list, so there is no need to browse all slots
+			_pointerFirstFreeSlot = NULL;
+			_unusedSlotsIndex = 0;
+			_usedSlotsCount = 0;
+		}
+	
+	private:
+		/** A slot stores an object when it is used, or the next free slot when it is free. */
+		union Slot
+		{
+			Slot *pointerNextFreeSlot; //!< The next slot of the free slots list.
+			typename std::aligned_storage<sizeof(T), alignof(T)>::type objectMemory; //!< Memory suitable to store an object.
+		};
+		
+		/** All slots. */
+		Slot _slots[SlotsCount];
+		/** The free slots list head (NULL when no slot has been freed since the last reset). */
+		Slot *_pointerFirstFreeSlot;
+		/** The first slot that has not been used since the last reset, all following slots are unused too. */
+		int _unusedSlotsIndex;
+};
+
+#endif
@@ -25,13 +25,14 @@ class PlayerFightingEntity: public FightingEntity
 		virtual bool modifyLife(int lifePointsAmount);
 		
 		// No need for documentation because it is the same as parent function
-		virtual BulletMovingEntity *shoot();
+		virtual bool shoot(BulletStore *pointerBulletStore);
 		
-		/** Generate a mortar shell facing the entity direction and play the associated effect.
-		 * @return A valid pointer if the entity was allowed to shot,
-		 * @return NULL if the entity could not shoot (no more ammunition, slower fire rate...).
+		/** Fire a mortar shell facing the entity direction and play the associated effect.
+		 * @param pointerBulletStore The store to add the mortar shell to.
+		 * @return true if the entity was allowed to shoot,
+		 * @return false if the entity could not shoot (no more ammunition, slower fire rate...).
 		 */
-		virtual BulletMovingEntity *shootSecondaryFire();
+		virtual bool shootSecondaryFire(BulletStore *pointerBulletStore);
 		
 		/** Get the remaining ammunition count.
 		 * @return The ammunition amount.
@@ -57,9 +58,6 @@ class PlayerFightingEntity: public FightingEntity
 			_ammunitionAmount += amount;
 		}
 		
-		/** Display the player at the screen center. */
-		virtual void render();
-		
 		/** Check for a pickable item on the underlaying block and get it if possible.
 		 * @return 0 if the game should continue,
 		 * @return 2 if the next level must be loaded.
@@ -68,7 +66,7 @@ class PlayerFightingEntity: public FightingEntity
 		
 	protected:
 		// No need for documentation because it is the same as parent function
-		virtual BulletMovingEntity *_fireBullet(int x, int y);
+		virtual void _fireBullet(BulletStore *pointerBulletStore, int x, int y);
 		
 	private:
 		/** All available bonuses. */
@@ -79,11 +77,6 @@ class PlayerFightingEntity: public FightingEntity
 			BONUS_BULLETPROOF_VEST //!< Enemy can't damage the player.
 		} Bonus;
 		
-		/** Display the player at this horizontal display coordinate. */
-		int _renderingX;
-		/** Display the player at this vertical display coordinate. */
-		int _renderingY;
-		
 		/** How many ammunition the player owns. */
 		int _ammunitionAmount; // Only player has limited ammunition, because what could do a munitions-less enemy ?
 		
@@ -31,6 +31,20 @@ namespace Renderer
 		FONT_SIZE_IDS_COUNT
 	} FontSizeId;
 
+	/** All display layers, from the bottommost to the topmost one. */
+	typedef enum
+	{
+		LAYER_ID_SCENE,
+		LAYER_ID_ENEMY_SPAWNERS,
+		LAYER_ID_ENEMIES,
+		LAYER_ID_BULLETS,
+		LAYER_ID_PLAYER,
+		LAYER_ID_EFFECTS,
+		LAYER_ID_OVERLAY,
+		LAYER_ID_INTERFACE,
+		LAYER_IDS_COUNT
+	} LayerId;
+
 	/** The renderer used to render to the game window. */
 	extern SDL_Renderer *pointerRenderer;
 
@@ -39,17 +53,18 @@ namespace Renderer
 	/** Contains the visible display (it can be though as the camera) topmost coordinate. */
 	extern int displayY;
 
-	/** The display width in pixels. */
+	/** The display width in pixels. In full screen mode, this is the rendering width before the display is upscaled to the screen resolution. */
 	extern int displayWidth;
-	/** The display height in pixels. */
+	/** The display height in pixels. In full screen mode, this is the rendering height before the display is upscaled to the screen resolution. */
 	extern int displayHeight;
 
 	/** Initialize the SDL2 library and create a window with a renderer.
 	* @param isFullScreenEnabled Set to 1 to start the game in full screen, set to 0 to start it in windowed mode.
+	* @param isHeadlessModeEnabled Set to 1 to create no window and render to an off-screen software surface instead, set to 0 to render to a window.
 	* @return 0 if all went successful,
 	* @return -1 if an error occurred.
 	*/
-	int initialize(bool isFullScreenEnabled);
+	int initialize(bool isFullScreenEnabled, bool isHeadlessModeEnabled);
 
 	/** Free all allocated resources.
 	* @note This function must be called after all SDL resources have been freed.
@@ -59,10 +74,10 @@ namespace Renderer
 	/** This function must be called at the really beginning of a frame rendering. */
 	void beginFrame();
 
-	/** End the rendering step by displaying the final picture on the screen. */
+	/** End the rendering step by displaying the final picture on the screen. The frame rate is limited to the display refresh rate, either by the vertical synchronization or by waiting when it is not available. */
 	void endFrame();
 
-	/** Render the provided text on a texture.
+	/** Render the provided text on a texture. This is slow, so use it only for texts that are rendered once and displayed many times, use renderText() for texts that often change.
 	* @param pointerStringText The string to render.
 	* @param colorId The text color.
 	* @param fontSizeId The font size.
@@ -71,6 +86,31 @@ namespace Renderer
 	*/
 	SDL_Texture *renderTextToTexture(const char *pointerStringText, TextColorId colorId, FontSizeId fontSizeId);
 
+	/** Get the size a text will have when displayed.
+	* @param pointerStringText The text.
+	* @param fontSizeId The font size.
+	* @param pointerWidth On output, contain the text width in pixels. Set to NULL if the width is not needed.
+	* @param pointerHeight On output, contain the text height in pixels. Set to NULL if the height is not needed.
+	*/
+	void getTextSize(const char *pointerStringText, FontSizeId fontSizeId, int *pointerWidth, int *pointerHeight);
+
+	/** Queue a text to be displayed at the specified display position, in the current layer. The characters come from the glyphs rasterized when the renderer was initialized, so displaying a different text each frame costs nothing more than displaying textures.
+	* @param pointerStringText The text to display. Non printable characters are displayed as question marks.
+	* @param colorId The text color.
+	* @param fontSizeId The font size.
+	* @param x Horizontal coordinate of the text top left corner.
+	* @param y Vertical coordinate of the text top left corner.
+	*/
+	void renderText(const char *pointerStringText, TextColorId colorId, FontSizeId fontSizeId, int x, int y);
+
+	/** Queue a text to be displayed at the display horizontal center, in the current layer.
+	* @param pointerStringText The text to display. Non printable characters are displayed as question marks.
+	* @param colorId The text color.
+	* @param fontSizeId The font size.
+	* @param y Vertical coordinate of the text top left corner. If set to -1 the text will be also centered vertically.
+	*/
+	void renderCenteredText(const char *pointerStringText, TextColorId colorId, FontSizeId fontSizeId, int y = -1);
+
 	/** Display the provided texture at the specified display position.
 	* @param pointerTexture The texture to display.
 	* @param x Horizontal coordinate of the texture top left corner.
@@ -83,6 +123,27 @@ namespace Renderer
 	* @param y Vertical coordinate of the texture top left corner. If set to -1 the texture will be also centered vertically.
 	*/
 	void renderCenteredTexture(SDL_Texture *pointerTexture, int y = -1);
+
+	/** Select the layer the next textures are queued to. The layer is reset to the scene one when a frame begins.
+	* @param layerId The layer.
+	*/
+	void setLayer(LayerId layerId);
+
+	/** Queue a texture area to be displayed at the specified display area, in the current layer. Queued textures are sorted by layer, then the textures of a layer using the same SDL texture are gathered (keeping the order they were queued in), so they can be displayed by a single rendering call. Textures that are not visible are discarded.
+	* @param pointerTexture The SDL texture containing the picture to display.
+	* @param pointerSourceRectangle The picture location in the SDL texture. Set to NULL to use the whole SDL texture.
+	* @param pointerDestinationRectangle Where to display the picture. Set to NULL to fill the whole display.
+	* @note Textures rendered to a texture render target are not queued, they are displayed in the order they are rendered.
+	*/
+	void renderBatchedTexture(SDL_Texture *pointerTexture, const SDL_Rect *pointerSourceRectangle, const SDL_Rect *pointerDestinationRectangle);
+
+	/** Display all queued textures. This function is automatically called when the frame ends, it must also be called before rendering anything without the queue or destroying a queued texture. */
+	void flushBatch();
+
+	/** Render to a texture instead of the display.
+	* @param pointerTexture The texture to render to, it must have been created with SDL_TEXTUREACCESS_TARGET access. Set to NULL to render to the display again.
+	*/
+	void setRenderTarget(SDL_Texture *pointerTexture);
 }
 
 #endif
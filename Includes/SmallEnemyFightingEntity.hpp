@@ -20,10 +20,21 @@ class SmallEnemyFightingEntity: public EnemyFightingEntity
 		
 		/** Free allocated resources. */
 		virtual ~SmallEnemyFightingEntity();
+		
+		/** Take the enemy memory from a pool instead of the heap.
+		 * @param size The enemy size in bytes.
+		 * @return The enemy memory.
+		 */
+		static void *operator new(size_t size);
+		
+		/** Give the enemy memory back to its pool.
+		 * @param pointerObject The enemy memory.
+		 */
+		static void operator delete(void *pointerObject);
 
 	protected:
 		// No need for documentation because it is the same as parent function
-		virtual BulletMovingEntity *_fireBullet(int x, int y);
+		virtual void _fireBullet(BulletStore *pointerBulletStore, int x, int y);
 };
 
 #endif
@@ -0,0 +1,103 @@
+/** @file SnapshotManager.hpp
+ * Pass the game state from the simulation thread to the rendering thread. The simulation records everything to display in a snapshot at the end of each game tick, then publishes it. The rendering thread always displays the newest published snapshot, so the game logic and the rendering can run at the same time on different processor cores.
+ * @author Adrien RICCIARDI
+ */
+#ifndef HPP_SNAPSHOT_MANAGER_HPP
+#define HPP_SNAPSHOT_MANAGER_HPP
+
+#include <HeadUpDisplay.hpp>
+#include <LevelManager.hpp>
+#include <Renderer.hpp>
+#include <SDL2/SDL.h>
+#include <Texture.hpp>
+#include <vector>
+
+namespace SnapshotManager
+{
+	/** A texture displayed on the map. */
+	typedef struct
+	{
+		SDL_Texture *pointerSDLTexture; //!< The SDL texture containing the picture.
+		SDL_Rect sourceRectangle; //!< The picture location in the SDL texture.
+		int previousX; //!< The map horizontal coordinate the texture had when the game tick started.
+		int previousY; //!< The map vertical coordinate the texture had when the game tick started.
+		int x; //!< The map horizontal coordinate the texture has when the game tick ended.
+		int y; //!< The map vertical coordinate the texture has when the game tick ended.
+	} Sprite;
+
+	/** A rectangle outline displayed on the map, used to check the entities collisions in debug mode. */
+	typedef struct
+	{
+		SDL_Rect rectangle; //!< The rectangle map coordinates and size.
+		SDL_Color color; //!< The outline color.
+	} DebugRectangle;
+
+	/** Everything needed to display a game tick. */
+	typedef struct
+	{
+		Uint64 tickTime; //!< The performance counter value when the game tick was due, used to interpolate the moving textures positions.
+		bool isInterpolated; //!< Display the textures at their final position when false (the game is paused, so nothing moves anymore).
+		int cameraPreviousX; //!< The display leftmost map coordinate when the game tick started.
+		int cameraPreviousY; //!< The display topmost map coordinate when the game tick started.
+		int cameraX; //!< The display leftmost map coordinate when the game tick ended.
+		int cameraY; //!< The display topmost map coordinate when the game tick ended.
+		std::vector<Sprite> sprites[Renderer::LAYER_IDS_COUNT]; //!< All textures to display, sorted by layer, in the order they must be displayed.
+		std::vector<DebugRectangle> debugRectangles; //!< All rectangles to display on top of the textures (only in debug mode).
+		HeadUpDisplay::State headUpDisplayState; //!< The values displayed by the HUD.
+		LevelManager::SceneUpdate sceneUpdate; //!< The scene changes that happened since the previous snapshot.
+		bool isPlayerHit; //!< Display the red overlay when true.
+		bool isPlayerDead; //!< Display the game lost message when true.
+		bool isGameFinished; //!< Display the game won message when true.
+	} Snapshot;
+
+	/** Create the lock protecting the snapshots exchange.
+	 * @return -1 if an error occurred,
+	 * @return 0 on success.
+	 */
+	int initialize();
+
+	/** Free all allocated resources. */
+	void uninitialize();
+
+	/** Start recording a new snapshot. The textures are recorded to the scene layer until setLayer() is called.
+	 * @return The snapshot to fill, all textures and debug rectangles recorded to it previously have been removed.
+	 * @note Must be called by the simulation thread only.
+	 */
+	Snapshot *beginSnapshot();
+
+	/** Select the layer the next textures are recorded to.
+	 * @param layerId The layer.
+	 */
+	void setLayer(Renderer::LayerId layerId);
+
+	/** Record the currently displayed image of a texture to the snapshot being recorded.
+	 * @param pointerTexture The texture.
+	 * @param previousX The map horizontal coordinate the texture had when the game tick started.
+	 * @param previousY The map vertical coordinate the texture had when the game tick started.
+	 * @param x The texture map horizontal coordinate.
+	 * @param y The texture map vertical coordinate.
+	 */
+	void addSprite(Texture *pointerTexture, int previousX, int previousY, int x, int y);
+
+	/** Record a rectangle outline to the snapshot being recorded.
+	 * @param pointerRectangle The rectangle map coordinates and size.
+	 * @param red The outline red component.
+	 * @param green The outline green component.
+	 * @param blue The outline blue component.
+	 */
+	void addDebugRectangle(const SDL_Rect *pointerRectangle, Uint8 red, Uint8 green, Uint8 blue);
+
+	/** Make the recorded snapshot available to the rendering thread. If the rendering thread did not display the previously published snapshot yet, the scene changes and the player hit state this snapshot contained are transferred to the new snapshot, so they are not lost.
+	 * @note Must be called by the simulation thread only.
+	 */
+	void publishSnapshot();
+
+	/** Get the newest published snapshot. The snapshot stays owned by the rendering thread until this function is called again.
+	 * @return NULL if no snapshot has been published yet,
+	 * @return the snapshot to display.
+	 * @note Must be called by the rendering thread only.
+	 */
+	Snapshot *getLatestSnapshot();
+}
+
+#endif
@@ -24,8 +24,8 @@ class StaticEntity: public Entity
 		// No need for documentation because it is the same as parent function
 		virtual ~StaticEntity() {}
 		
-		/** Display the entity at its current location on the map. */
-		virtual void render();
+		/** Record the entity at its current location on the map to the snapshot being recorded. */
+		virtual void addToSnapshot();
 		
 		// No need for documentation because it is the same as parent function
 		virtual int getX();
@@ -17,6 +17,12 @@ class Texture
 		 */
 		Texture(SDL_Texture *pointerSDLTexture);
 		
+		/** Create a still texture from a part of a SDL texture, like a texture atlas.
+		 * @param pointerSDLTexture The SDL texture containing the picture.
+		 * @param pointerSourceRectangle The picture location in the SDL texture.
+		 */
+		Texture(SDL_Texture *pointerSDLTexture, const SDL_Rect *pointerSourceRectangle);
+		
 		/** Free allocated resources. */
 		virtual ~Texture() {}
 		
@@ -50,10 +56,25 @@ class Texture
 		{
 			return _pointerSDLTexture;
 		}
+		
+		/** Get the texture location in the SDL texture, which must be provided to the SDL rendering functions.
+		 * @return The SDL texture area containing the texture.
+		 */
+		inline const SDL_Rect *getSourceRectangle()
+		{
+			return &_sourceRectangle;
+		}
+		
+		/** Get the location in the SDL texture of the picture the texture currently displays.
+		 * @param pointerRectangle On output, contain the SDL texture area to display.
+		 */
+		virtual void getDisplayedSourceRectangle(SDL_Rect *pointerRectangle);
 
 	protected:
 		/** The texture. */
 		SDL_Texture *_pointerSDLTexture;
+		/** The texture location in the SDL texture (the SDL texture can contain many textures). */
+		SDL_Rect _sourceRectangle;
 		
 		/** Texture width in pixels. */
 		int _width;
@@ -0,0 +1,21 @@
+/** @file TimeManager.hpp
+ * Provide the game simulation time, which elapses only when the game logic is updated.
+ * @author Adrien RICCIARDI
+ */
+#ifndef HPP_TIME_MANAGER_HPP
+#define HPP_TIME_MANAGER_HPP
+
+namespace TimeManager
+{
+	/** Get the current simulation time. This time is not related to the wall clock, so it stops when the game is paused and it does not depend on how fast the game logic is updated.
+	 * @return How many milliseconds of game have been simulated since the program started.
+	 */
+	unsigned int getTicks();
+
+	/** Make the simulation time elapse by one game logic update period.
+	 * @note Must be called once at the beginning of each game tick, before any entity is moved or updated.
+	 */
+	void tick();
+}
+
+#endif
@@ -0,0 +1,27 @@
+/** @file WorkerPool.hpp
+ * Share independent computations between several threads. The worker threads sleep until a parallel loop is run, then they process the loop items together with the calling thread.
+ * @author Adrien RICCIARDI
+ */
+#ifndef HPP_WORKER_POOL_HPP
+#define HPP_WORKER_POOL_HPP
+
+namespace WorkerPool
+{
+	/** Start the worker threads. The rendering and the game logic threads already use two processor cores, so a thread is started for each remaining core.
+	 * @return -1 if an error occurred,
+	 * @return 0 on success.
+	 */
+	int initialize();
+
+	/** Stop all worker threads. */
+	void uninitialize();
+
+	/** Call a function for each item of a range, the items being shared between the worker threads and the calling thread. The items are processed in no particular order.
+	 * @param pointerFunction The function to call with the item index. It must not modify anything shared with the other items.
+	 * @param itemsCount How many items to process, the item indexes go from 0 to itemsCount - 1.
+	 * @note The function returns when all items have been processed. It must be called by one thread at a time.
+	 */
+	void runParallelLoop(void (*pointerFunction)(int itemIndex), int itemsCount);
+}
+
+#endif
@@ -3,10 +3,15 @@
  * @author Adrien RICCIARDI
  */
 #include <AnimatedTexture.hpp>
+#include <Configuration.hpp>
 #include <Log.hpp>
+#include <ObjectPool.hpp>
 #include <Renderer.hpp>
 
-AnimatedTexture::AnimatedTexture(SDL_Texture *pointerSDLTexture, int imagesCount, int framesPerImageCount, bool isAnimationLooping): Texture(pointerSDLTexture)
+/** All animated textures memory. */
+static ObjectPool<AnimatedTexture, CONFIGURATION_OBJECT_POOL_ANIMATED_TEXTURES_COUNT> _pool("animated textures");
+
+AnimatedTexture::AnimatedTexture(SDL_Texture *pointerSDLTexture, const SDL_Rect *pointerSourceRectangle, int imagesCount, int framesPerImageCount, bool isAnimationLooping): Texture(pointerSDLTexture, pointerSourceRectangle)
 {
 	_currentImageIndex = 0;
 	_framesCounter = 0;
@@ -19,7 +24,7 @@ AnimatedTexture::AnimatedTexture(SDL_Texture *pointerSDLTexture, int imagesCount
 	LOG_DEBUG("Created animated texture. Single image width : %d, single image height : %d.", _width, _height);
 }
 
-int AnimatedTexture::render(int x, int y)
+int AnimatedTexture::update()
 {
 	// Should the next image be displayed ?
 	_framesCounter++;
@@ -36,6 +41,11 @@ int AnimatedTexture::render(int x, int y)
 		_framesCounter = 0;
 	}
 	
+	return 0;
+}
+
+int AnimatedTexture::render(int x, int y)
+{
 	// Set texture position on display
 	SDL_Rect positionRectangle;
 	positionRectangle.x = x;
@@ -43,18 +53,30 @@ int AnimatedTexture::render(int x, int y)
 	positionRectangle.w = _width;
 	positionRectangle.h = _height;
 	
-	// Render texture only if it is visible on the screen
-	if ((x + _width >= 0) && (y + _height >= 0) && (x < Renderer::displayWidth) && (y < Renderer::displayHeight))
-	{
-		// Determine the part of the sprite to display
-		SDL_Rect displayingRectangle;
-		displayingRectangle.x = _currentImageIndex * _width;
-		displayingRectangle.y = 0;
-		displayingRectangle.w = _width;
-		displayingRectangle.h = _height;
-		
-		SDL_RenderCopy(Renderer::pointerRenderer, _pointerSDLTexture, &displayingRectangle, &positionRectangle);
-	}
+	// Determine the part of the sprite to display
+	SDL_Rect displayingRectangle;
+	getDisplayedSourceRectangle(&displayingRectangle);
+	
+	// The renderer discards the texture if it is not visible on the screen
+	Renderer::renderBatchedTexture(_pointerSDLTexture, &displayingRectangle, &positionRectangle);
 	
 	return 0;
 }
+
+void AnimatedTexture::getDisplayedSourceRectangle(SDL_Rect *pointerRectangle)
+{
+	pointerRectangle->x = _sourceRectangle.x + (_currentImageIndex * _width);
+	pointerRectangle->y = _sourceRectangle.y;
+	pointerRectangle->w = _width;
+	pointerRectangle->h = _height;
+}
+
+void *AnimatedTexture::operator new(size_t size)
+{
+	return _pool.allocate(size);
+}
+
+void AnimatedTexture::operator delete(void *pointerObject)
+{
+	_pool.release(pointerObject);
+}
@@ -3,11 +3,15 @@
  * @author Adrien RICCIARDI
  */
 #include <AnimatedTextureStaticEntity.hpp>
-#include <Renderer.hpp>
+#include <Configuration.hpp>
+#include <ObjectPool.hpp>
+
+/** All effects memory. */
+static ObjectPool<AnimatedTextureStaticEntity, CONFIGURATION_OBJECT_POOL_EFFECTS_COUNT> _pool("effects");
 
 AnimatedTextureStaticEntity::AnimatedTextureStaticEntity(int x, int y, AnimatedTexture *pointerTexture): StaticEntity(x, y, pointerTexture)
 {
-	_isAnimationTerminated = 0;
+	_pointerAnimatedTexture = pointerTexture;
 }
 
 AnimatedTextureStaticEntity::~AnimatedTextureStaticEntity()
@@ -15,13 +19,17 @@ AnimatedTextureStaticEntity::~AnimatedTextureStaticEntity()
 	delete _pointerTexture;
 }
 
-void AnimatedTextureStaticEntity::render()
+int AnimatedTextureStaticEntity::update()
 {
-	// Display the animation current image
-	if (_pointerTexture->render(_positionRectangle.x - Renderer::displayX, _positionRectangle.y - Renderer::displayY) != 0) _isAnimationTerminated = 1;
+	return _pointerAnimatedTexture->update();
 }
 
-int AnimatedTextureStaticEntity::update()
+void *AnimatedTextureStaticEntity::operator new(size_t size)
+{
+	return _pool.allocate(size);
+}
+
+void AnimatedTextureStaticEntity::operator delete(void *pointerObject)
 {
-	return _isAnimationTerminated;
+	_pool.release(pointerObject);
 }
@@ -114,6 +114,9 @@ namespace AudioManager
 	/** Tell the thread it must exit. */
 	static volatile int _isThreadTerminated = 0;
 
+	/** Tell whether an audio device has been opened. When no device is used, all playing functions silently do nothing. */
+	static bool _isAudioDeviceEnabled = false;
+
 	/** Load a sound from a wave file.
 	* @param pointerStringFileName The file to load.
 	* @return A pointer on the chunk containing the sound.
@@ -168,8 +171,16 @@ namespace AudioManager
 		return 0;
 	}
 
-	int initialize()
+	int initialize(bool isAudioDeviceEnabled)
 	{
+		// Do not touch the audio hardware at all if no sound is needed
+		_isAudioDeviceEnabled = isAudioDeviceEnabled;
+		if (!_isAudioDeviceEnabled)
+		{
+			LOG_INFORMATION("Audio device is disabled, no sound will be played.");
+			return 0;
+		}
+		
 		// Open audio mixer
 		if (Mix_OpenAudio(CONFIGURATION_AUDIO_SAMPLING_FREQUENCY, MIX_DEFAULT_FORMAT, 2, 1024) != 0) // Chunk size has been randomly chosen due to extremely explicit documentation...
 		{
@@ -235,6 +246,9 @@ namespace AudioManager
 
 	void uninitialize()
 	{
+		// Nothing was allocated if no audio device was opened
+		if (!_isAudioDeviceEnabled) return;
+		
 		// Tell the thread to exit
 		_isThreadTerminated = 1;
 		_wakeUpMusicThread();
@@ -260,6 +274,8 @@ namespace AudioManager
 	{
 		assert(id < SOUND_IDS_COUNT);
 		
+		if (!_isAudioDeviceEnabled) return;
+		
 		// Try to play the sound on the first available channel
 		int channel = Mix_PlayChannel(-1, _pointerSounds[id], 0);
 		if (channel == -1)
@@ -274,6 +290,8 @@ namespace AudioManager
 
 	void playMusic()
 	{
+		if (!_isAudioDeviceEnabled) return;
+		
 		// Select a random music
 		int musicIndex = rand() % MUSICS_COUNT;
 		
@@ -284,12 +302,16 @@ namespace AudioManager
 
 	void pauseMusic(bool isMusicPaused)
 	{
+		if (!_isAudioDeviceEnabled) return;
+		
 		if (isMusicPaused) Mix_PauseMusic();
 		else Mix_ResumeMusic();
 	}
 
 	void stopAllSounds()
 	{
+		if (!_isAudioDeviceEnabled) return;
+		
 		Mix_HaltChannel(-1);
 	}
 	
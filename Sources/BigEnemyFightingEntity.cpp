@@ -3,15 +3,19 @@
  * @author Adrien RICCIARDI
  */
 #include <BigEnemyFightingEntity.hpp>
+#include <Configuration.hpp>
 #include <EffectManager.hpp>
-#include <SDL2/SDL.h>
+#include <ObjectPool.hpp>
 #include <TextureManager.hpp>
+#include <TimeManager.hpp>
+
+/** All big enemies memory. */
+static ObjectPool<BigEnemyFightingEntity, CONFIGURATION_OBJECT_POOL_BIG_ENEMIES_COUNT> _pool("big enemies");
 
 BigEnemyFightingEntity::BigEnemyFightingEntity(int x, int y): EnemyFightingEntity(x, y, TextureManager::TEXTURE_ID_BIG_ENEMY_FACING_UP, 1, 10, 10000, TextureManager::TEXTURE_ID_BIG_ENEMY_BULLET_FACING_UP, EffectManager::EFFECT_ID_BIG_ENEMY_MUZZLE_FLASH_FACING_UP, EffectManager::EFFECT_ID_BIG_ENEMY_EXPLOSION)
 {
 	// Make big enemies wait 3 seconds before shooting (to avoid them shooting instantly when spawned)
-	unsigned int currentTime = SDL_GetTicks();
-	if (currentTime > 7000) _lastShotTime = currentTime - 7000;
+	_lastShotTime = TimeManager::getTicks() - 7000; // Unsigned arithmetic wraps correctly when the game has just started
 }
 
 BigEnemyFightingEntity::~BigEnemyFightingEntity() {}
@@ -51,7 +55,17 @@ int BigEnemyFightingEntity::update()
 	return EnemyFightingEntity::update();
 }
 
-BulletMovingEntity *BigEnemyFightingEntity::_fireBullet(int x, int y)
+void BigEnemyFightingEntity::_fireBullet(BulletStore *pointerBulletStore, int x, int y)
+{
+	pointerBulletStore->addBullet(x, y, TextureManager::TEXTURE_ID_BIG_ENEMY_BULLET_FACING_UP, 4, _facingDirection, 20, false);
+}
+
+void *BigEnemyFightingEntity::operator new(size_t size)
+{
+	return _pool.allocate(size);
+}
+
+void BigEnemyFightingEntity::operator delete(void *pointerObject)
 {
-	return new BulletMovingEntity(x, y, TextureManager::TEXTURE_ID_BIG_ENEMY_BULLET_FACING_UP, 4, _facingDirection, 20, 0);
+	_pool.release(pointerObject);
 }
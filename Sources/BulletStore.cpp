@@ -0,0 +1,230 @@
+/** @file BulletStore.cpp
+ * See BulletStore.hpp for description.
+ * @author Adrien RICCIARDI
+ */
+#include <BulletStore.hpp>
+#include <cassert>
+#include <LevelManager.hpp>
+#include <Log.hpp>
+#include <Renderer.hpp>
+#include <SnapshotManager.hpp>
+
+BulletStore::BulletStore()
+{
+	_bulletsCount = 0;
+}
+
+void BulletStore::addBullet(int x, int y, TextureManager::TextureId facingUpTextureId, int movingPixelsAmount, MovingEntity::Direction facingDirection, int damageAmount, bool isEnemySpawnerDamageable)
+{
+	// Do not allocate more memory when there are too many bullets, simply discard the new bullet
+	if (_bulletsCount >= CONFIGURATION_BULLET_MAXIMUM_COUNT)
+	{
+		LOG_DEBUG("Too many bullets, discarding new bullet.");
+		return;
+	}
+	int i = _bulletsCount;
+	_bulletsCount++;
+	
+	// Bullet never changes its direction, so only the texture of this direction is needed
+	Texture *pointerTexture = TextureManager::getTextureFromId(static_cast<TextureManager::TextureId>(facingUpTextureId + facingDirection));
+	_pointerTextures[i] = pointerTexture;
+	_widths[i] = pointerTexture->getWidth();
+	_heights[i] = pointerTexture->getHeight();
+	
+	// Set position
+	_positionsX[i] = x;
+	_positionsY[i] = y;
+	_previousPositionsX[i] = x;
+	_previousPositionsY[i] = y;
+	
+	// Set movement
+	_directions[i] = facingDirection;
+	switch (facingDirection)
+	{
+		case MovingEntity::DIRECTION_UP:
+			_directionsX[i] = 0;
+			_directionsY[i] = -1;
+			break;
+			
+		case MovingEntity::DIRECTION_DOWN:
+			_directionsX[i] = 0;
+			_directionsY[i] = 1;
+			break;
+			
+		case MovingEntity::DIRECTION_LEFT:
+			_directionsX[i] = -1;
+			_directionsY[i] = 0;
+			break;
+			
+		default:
+			_directionsX[i] = 1;
+			_directionsY[i] = 0;
+			break;
+	}
+	_movingPixelsAmounts[i] = movingPixelsAmount;
+	_movedDistances[i] = 0;
+	
+	_damageAmounts[i] = -damageAmount;
+	_isDestroyed[i] = false;
+	
+	// Collide with enemy spawners when bullet is shot by an enemy, so the bullet can't damage the spawner
+	if (isEnemySpawnerDamageable) _collisionBlockContents[i] = LevelManager::BLOCK_CONTENT_WALL; // Do not collide with enemy spawners to allow bullets enter the enemy spawner position rectangle, so it can be damaged
+	else _collisionBlockContents[i] = LevelManager::BLOCK_CONTENT_WALL | LevelManager::BLOCK_CONTENT_ENEMY_SPAWNER;
+}
+
+void BulletStore::removeBullet(int index)
+{
+	assert(index < _bulletsCount);
+	
+	// Move the last bullet to the removed bullet location to keep the arrays contiguous
+	_bulletsCount--;
+	if (index == _bulletsCount) return;
+	
+	_positionsX[index] = _positionsX[_bulletsCount];
+	_positionsY[index] = _positionsY[_bulletsCount];
+	_previousPositionsX[index] = _previousPositionsX[_bulletsCount];
+	_previousPositionsY[index] = _previousPositionsY[_bulletsCount];
+	_widths[index] = _widths[_bulletsCount];
+	_heights[index] = _heights[_bulletsCount];
+	_directions[index] = _directions[_bulletsCount];
+	_directionsX[index] = _directionsX[_bulletsCount];
+	_directionsY[index] = _directionsY[_bulletsCount];
+	_movingPixelsAmounts[index] = _movingPixelsAmounts[_bulletsCount];
+	_movedDistances[index] = _movedDistances[_bulletsCount];
+	_damageAmounts[index] = _damageAmounts[_bulletsCount];
+	_collisionBlockContents[index] = _collisionBlockContents[_bulletsCount];
+	_isDestroyed[index] = _isDestroyed[_bulletsCount];
+	_pointerTextures[index] = _pointerTextures[_bulletsCount];
+}
+
+void BulletStore::update()
+{
+	int i, x, y, firstSideDistanceToWall, secondSideDistanceToWall, range = 2 * Renderer::displayWidth;
+	
+	// Find how far each bullet can go before hitting a wall, checking both corners of the bullet front side (the same way MovingEntity does)
+	for (i = 0; i < _bulletsCount; i++)
+	{
+		x = _positionsX[i];
+		y = _positionsY[i];
+		switch (_directions[i])
+		{
+			case MovingEntity::DIRECTION_UP:
+				firstSideDistanceToWall = LevelManager::getDistanceFromUpperBlock(x, y, _collisionBlockContents[i]);
+				secondSideDistanceToWall = LevelManager::getDistanceFromUpperBlock(x + _widths[i] - 1, y, _collisionBlockContents[i]);
+				break;
+				
+			case MovingEntity::DIRECTION_DOWN:
+				firstSideDistanceToWall = LevelManager::getDistanceFromDownerBlock(x, y + _heights[i], _collisionBlockContents[i]);
+				secondSideDistanceToWall = LevelManager::getDistanceFromDownerBlock(x + _widths[i] - 1, y + _heights[i], _collisionBlockContents[i]);
+				break;
+				
+			case MovingEntity::DIRECTION_LEFT:
+				firstSideDistanceToWall = LevelManager::getDistanceFromLeftmostBlock(x, y, _collisionBlockContents[i]);
+				secondSideDistanceToWall = LevelManager::getDistanceFromLeftmostBlock(x, y + _heights[i] - 1, _collisionBlockContents[i]);
+				break;
+				
+			default:
+				firstSideDistanceToWall = LevelManager::getDistanceFromRightmostBlock(x + _widths[i], y, _collisionBlockContents[i]);
+				secondSideDistanceToWall = LevelManager::getDistanceFromRightmostBlock(x + _widths[i], y + _heights[i] - 1, _collisionBlockContents[i]);
+				break;
+		}
+		
+		// Keep the smaller distance
+		if (secondSideDistanceToWall < firstSideDistanceToWall) firstSideDistanceToWall = secondSideDistanceToWall;
+		_allowedMovingPixelsAmounts[i] = firstSideDistanceToWall;
+	}
+	
+	// Move all bullets (this loop does not call any function, so the compiler can vectorize it)
+	int movingPixelsAmount;
+	for (i = 0; i < _bulletsCount; i++)
+	{
+		movingPixelsAmount = _movingPixelsAmounts[i];
+		if (_allowedMovingPixelsAmounts[i] < movingPixelsAmount) movingPixelsAmount = _allowedMovingPixelsAmounts[i];
+		
+		_previousPositionsX[i] = _positionsX[i];
+		_previousPositionsY[i] = _positionsY[i];
+		_positionsX[i] += movingPixelsAmount * _directionsX[i];
+		_positionsY[i] += movingPixelsAmount * _directionsY[i];
+		_movedDistances[i] += movingPixelsAmount;
+		
+		// A bullet that did not move has hit a wall, a bullet that went too far is destroyed too
+		_isDestroyed[i] = (movingPixelsAmount == 0) | (_movedDistances[i] >= range);
+	}
+}
+
+void BulletStore::getPositionRectangle(int index, SDL_Rect *pointerPositionRectangle)
+{
+	pointerPositionRectangle->x = _positionsX[index];
+	pointerPositionRectangle->y = _positionsY[index];
+	pointerPositionRectangle->w = _widths[index];
+	pointerPositionRectangle->h = _heights[index];
+}
+
+void BulletStore::getCrossedRectangle(int index, SDL_Rect *pointerCrossedRectangle)
+{
+	int movedPixelsAmountX = _positionsX[index] - _previousPositionsX[index], movedPixelsAmountY = _positionsY[index] - _previousPositionsY[index];
+	
+	// The bullet moves on one axis only, so the crossed area is the bullet rectangle stretched from the previous position to the current one
+	if (movedPixelsAmountX < 0)
+	{
+		pointerCrossedRectangle->x = _positionsX[index];
+		movedPixelsAmountX = -movedPixelsAmountX;
+	}
+	else pointerCrossedRectangle->x = _previousPositionsX[index];
+	if (movedPixelsAmountY < 0)
+	{
+		pointerCrossedRectangle->y = _positionsY[index];
+		movedPixelsAmountY = -movedPixelsAmountY;
+	}
+	else pointerCrossedRectangle->y = _previousPositionsY[index];
+	pointerCrossedRectangle->w = _widths[index] + movedPixelsAmountX;
+	pointerCrossedRectangle->h = _heights[index] + movedPixelsAmountY;
+}
+
+void BulletStore::moveToHitPosition(int index, const SDL_Rect *pointerHitRectangle)
+{
+	int position, minimumPosition, maximumPosition;
+	
+	// Compute the position where the bullet front side enters the hit rectangle by one pixel
+	switch (_directions[index])
+	{
+		case MovingEntity::DIRECTION_UP:
+			position = pointerHitRectangle->y + pointerHitRectangle->h - 1;
+			minimumPosition = _positionsY[index];
+			maximumPosition = _previousPositionsY[index];
+			break;
+			
+		case MovingEntity::DIRECTION_DOWN:
+			position = pointerHitRectangle->y - _heights[index] + 1;
+			minimumPosition = _previousPositionsY[index];
+			maximumPosition = _positionsY[index];
+			break;
+			
+		case MovingEntity::DIRECTION_LEFT:
+			position = pointerHitRectangle->x + pointerHitRectangle->w - 1;
+			minimumPosition = _positionsX[index];
+			maximumPosition = _previousPositionsX[index];
+			break;
+			
+		default:
+			position = pointerHitRectangle->x - _widths[index] + 1;
+			minimumPosition = _previousPositionsX[index];
+			maximumPosition = _positionsX[index];
+			break;
+	}
+	
+	// The bullet can only have been stopped between its previous and current positions (the rectangle may already overlap the bullet previous position if the entity moved onto the bullet)
+	if (position < minimumPosition) position = minimumPosition;
+	else if (position > maximumPosition) position = maximumPosition;
+	
+	if (_directionsX[index] == 0) _positionsY[index] = position;
+	else _positionsX[index] = position;
+}
+
+void BulletStore::addToSnapshot()
+{
+	int i;
+	
+	// Keep the position before the last update, so the bullet position can be interpolated between the last two updates
+	for (i = 0; i < _bulletsCount; i++) SnapshotManager::addSprite(_pointerTextures[i], _previousPositionsX[i], _previousPositionsY[i], _positionsX[i], _positionsY[i]);
+}
@@ -0,0 +1,200 @@
+/** @file CollisionManager.cpp
+ * See CollisionManager.hpp for description.
+ * @author Adrien RICCIARDI
+ */
+#include <cassert>
+#include <CollisionManager.hpp>
+#include <Configuration.hpp>
+#include <cstring>
+
+namespace CollisionManager
+{
+	/** How many cells a grid contains. Grids are always sized for the biggest possible level, so they do not need to be resized when a level is loaded. */
+	#define GRID_CELLS_COUNT (CONFIGURATION_LEVEL_MAXIMUM_WIDTH * CONFIGURATION_LEVEL_MAXIMUM_HEIGHT)
+
+	/** Compute a cell index according to its coordinates.
+	* @param gridId The grid the cell belongs to.
+	* @param x X coordinate (in blocks).
+	* @param y Y coordinate (in blocks).
+	* @return The corresponding index.
+	*/
+	#define COMPUTE_CELL_INDEX(gridId, x, y) (((gridId) * GRID_CELLS_COUNT) + ((y) * CONFIGURATION_LEVEL_MAXIMUM_WIDTH) + (x))
+
+	/** All grids cells, each cell is the head of a linked list of the entities whose top left corner is located in the corresponding block. */
+	static Entity *_pointerCellEntities[GRID_IDS_COUNT * GRID_CELLS_COUNT];
+
+	/** Compute the index of the cell containing an entity top left corner.
+	 * @param gridId The grid the entity belongs to.
+	 * @param pointerEntity The entity.
+	 * @return The cell index.
+	 */
+	static inline int _getEntityCellIndex(GridId gridId, Entity *pointerEntity)
+	{
+		SDL_Rect *pointerPositionRectangle = pointerEntity->getPositionRectangle();
+		int xBlock = pointerPositionRectangle->x / CONFIGURATION_LEVEL_BLOCK_SIZE;
+		int yBlock = pointerPositionRectangle->y / CONFIGURATION_LEVEL_BLOCK_SIZE;
+		
+		// Make sure the entity is in the level bounds
+		assert(xBlock >= 0);
+		assert(xBlock < CONFIGURATION_LEVEL_MAXIMUM_WIDTH);
+		assert(yBlock >= 0);
+		assert(yBlock < CONFIGURATION_LEVEL_MAXIMUM_HEIGHT);
+		
+		return COMPUTE_CELL_INDEX(gridId, xBlock, yBlock);
+	}
+
+	/** Insert an entity at the beginning of a cell entities list.
+	 * @param cellIndex The cell to insert the entity into.
+	 * @param pointerEntity The entity to insert.
+	 */
+	static inline void _linkEntity(int cellIndex, Entity *pointerEntity)
+	{
+		Entity *pointerFirstEntity = _pointerCellEntities[cellIndex];
+		
+		pointerEntity->pointerPreviousCollisionGridEntity = NULL;
+		pointerEntity->pointerNextCollisionGridEntity = pointerFirstEntity;
+		if (pointerFirstEntity != NULL) pointerFirstEntity->pointerPreviousCollisionGridEntity = pointerEntity;
+		_pointerCellEntities[cellIndex] = pointerEntity;
+		pointerEntity->collisionGridCellIndex = cellIndex;
+	}
+
+	/** Remove an entity from its cell entities list.
+	 * @param pointerEntity The entity to remove.
+	 */
+	static inline void _unlinkEntity(Entity *pointerEntity)
+	{
+		if (pointerEntity->pointerPreviousCollisionGridEntity != NULL) pointerEntity->pointerPreviousCollisionGridEntity->pointerNextCollisionGridEntity = pointerEntity->pointerNextCollisionGridEntity;
+		else _pointerCellEntities[pointerEntity->collisionGridCellIndex] = pointerEntity->pointerNextCollisionGridEntity; // This is the first entity of the list
+		if (pointerEntity->pointerNextCollisionGridEntity != NULL) pointerEntity->pointerNextCollisionGridEntity->pointerPreviousCollisionGridEntity = pointerEntity->pointerPreviousCollisionGridEntity;
+	}
+
+	void addEntity(GridId gridId, Entity *pointerEntity)
+	{
+		assert(gridId < GRID_IDS_COUNT);
+		assert(pointerEntity->collisionGridCellIndex == -1);
+		
+		_linkEntity(_getEntityCellIndex(gridId, pointerEntity), pointerEntity);
+	}
+
+	void removeEntity(Entity *pointerEntity)
+	{
+		if (pointerEntity->collisionGridCellIndex == -1) return;
+		
+		_unlinkEntity(pointerEntity);
+		pointerEntity->collisionGridCellIndex = -1;
+	}
+
+	void updateEntity(Entity *pointerEntity)
+	{
+		assert(pointerEntity->collisionGridCellIndex != -1);
+		
+		// Nothing to do if the entity is still in the same cell, which is the most common case
+		GridId gridId = static_cast<GridId>(pointerEntity->collisionGridCellIndex / GRID_CELLS_COUNT);
+		int cellIndex = _getEntityCellIndex(gridId, pointerEntity);
+		if (cellIndex == pointerEntity->collisionGridCellIndex) return;
+		
+		_unlinkEntity(pointerEntity);
+		_linkEntity(cellIndex, pointerEntity);
+	}
+
+	void clear()
+	{
+		memset(_pointerCellEntities, 0, sizeof(_pointerCellEntities));
+	}
+
+	/** Compute the cells that can contain the entities overlapping a rectangle.
+	 * @param pointerRectangle The rectangle.
+	 * @param pointerXStartingBlock On output, contain the leftmost cell X coordinate (in blocks).
+	 * @param pointerYStartingBlock On output, contain the topmost cell Y coordinate (in blocks).
+	 * @param pointerXEndingBlock On output, contain the rightmost cell X coordinate (in blocks).
+	 * @param pointerYEndingBlock On output, contain the downer cell Y coordinate (in blocks).
+	 */
+	static inline void _getRectangleCells(SDL_Rect *pointerRectangle, int *pointerXStartingBlock, int *pointerYStartingBlock, int *pointerXEndingBlock, int *pointerYEndingBlock)
+	{
+		// An entity is stored in the cell of its top left corner and it is not bigger than a block, so an entity overlapping the rectangle can also be stored in the cells located at the left of and above the rectangle
+		*pointerXStartingBlock = (pointerRectangle->x / CONFIGURATION_LEVEL_BLOCK_SIZE) - 1;
+		if (*pointerXStartingBlock < 0) *pointerXStartingBlock = 0;
+		*pointerYStartingBlock = (pointerRectangle->y / CONFIGURATION_LEVEL_BLOCK_SIZE) - 1;
+		if (*pointerYStartingBlock < 0) *pointerYStartingBlock = 0;
+		*pointerXEndingBlock = (pointerRectangle->x + pointerRectangle->w - 1) / CONFIGURATION_LEVEL_BLOCK_SIZE;
+		if (*pointerXEndingBlock >= CONFIGURATION_LEVEL_MAXIMUM_WIDTH) *pointerXEndingBlock = CONFIGURATION_LEVEL_MAXIMUM_WIDTH - 1;
+		*pointerYEndingBlock = (pointerRectangle->y + pointerRectangle->h - 1) / CONFIGURATION_LEVEL_BLOCK_SIZE;
+		if (*pointerYEndingBlock >= CONFIGURATION_LEVEL_MAXIMUM_HEIGHT) *pointerYEndingBlock = CONFIGURATION_LEVEL_MAXIMUM_HEIGHT - 1;
+	}
+
+	Entity *getCollidingEntity(GridId gridId, SDL_Rect *pointerRectangle)
+	{
+		int xStartingBlock, yStartingBlock, xEndingBlock, yEndingBlock, xBlock, yBlock;
+		Entity *pointerEntity;
+		
+		assert(gridId < GRID_IDS_COUNT);
+		
+		_getRectangleCells(pointerRectangle, &xStartingBlock, &yStartingBlock, &xEndingBlock, &yEndingBlock);
+		
+		// Check all entities of all these cells
+		for (yBlock = yStartingBlock; yBlock <= yEndingBlock; yBlock++)
+		{
+			for (xBlock = xStartingBlock; xBlock <= xEndingBlock; xBlock++)
+			{
+				for (pointerEntity = _pointerCellEntities[COMPUTE_CELL_INDEX(gridId, xBlock, yBlock)]; pointerEntity != NULL; pointerEntity = pointerEntity->pointerNextCollisionGridEntity)
+				{
+					if (SDL_HasIntersection(pointerRectangle, pointerEntity->getPositionRectangle())) return pointerEntity;
+				}
+			}
+		}
+		
+		return NULL;
+	}
+
+	Entity *getFirstCollidingEntity(GridId gridId, SDL_Rect *pointerRectangle, MovingEntity::Direction direction)
+	{
+		int xStartingBlock, yStartingBlock, xEndingBlock, yEndingBlock, xBlock, yBlock, distance, firstEntityDistance = 0;
+		Entity *pointerEntity, *pointerFirstEntity = NULL;
+		SDL_Rect *pointerPositionRectangle;
+		
+		assert(gridId < GRID_IDS_COUNT);
+		
+		_getRectangleCells(pointerRectangle, &xStartingBlock, &yStartingBlock, &xEndingBlock, &yEndingBlock);
+		
+		// Check all entities of all these cells, keeping the one whose side facing the object is the closest to the object starting position
+		for (yBlock = yStartingBlock; yBlock <= yEndingBlock; yBlock++)
+		{
+			for (xBlock = xStartingBlock; xBlock <= xEndingBlock; xBlock++)
+			{
+				for (pointerEntity = _pointerCellEntities[COMPUTE_CELL_INDEX(gridId, xBlock, yBlock)]; pointerEntity != NULL; pointerEntity = pointerEntity->pointerNextCollisionGridEntity)
+				{
+					pointerPositionRectangle = pointerEntity->getPositionRectangle();
+					if (!SDL_HasIntersection(pointerRectangle, pointerPositionRectangle)) continue;
+					
+					// The smaller the distance, the sooner the entity is met
+					switch (direction)
+					{
+						case MovingEntity::DIRECTION_UP:
+							distance = -(pointerPositionRectangle->y + pointerPositionRectangle->h);
+							break;
+							
+						case MovingEntity::DIRECTION_DOWN:
+							distance = pointerPositionRectangle->y;
+							break;
+							
+						case MovingEntity::DIRECTION_LEFT:
+							distance = -(pointerPositionRectangle->x + pointerPositionRectangle->w);
+							break;
+							
+						default:
+							distance = pointerPositionRectangle->x;
+							break;
+					}
+					
+					if ((pointerFirstEntity == NULL) || (distance < firstEntityDistance))
+					{
+						pointerFirstEntity = pointerEntity;
+						firstEntityDistance = distance;
+					}
+				}
+			}
+		}
+		
+		return pointerFirstEntity;
+	}
+}
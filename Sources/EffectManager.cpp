@@ -6,9 +6,9 @@
 #include <AudioManager.hpp>
 #include <cassert>
 #include <EffectManager.hpp>
-#include <list>
 #include <Log.hpp>
 #include <TextureManager.hpp>
+#include <vector>
 
 namespace EffectManager
 {
@@ -169,8 +169,8 @@ namespace EffectManager
 		}
 	};
 
-	/** All animated textures. */
-	static std::list<AnimatedTextureStaticEntity *> _animatedTexturesList;
+	/** All animated textures, from the oldest to the newest one. A vector is used because it keeps its memory when animated textures are removed, so adding an effect does not allocate memory once the vector has grown enough. */
+	static std::vector<AnimatedTextureStaticEntity *> _animatedTextures;
 
 	int getEffectTextureWidth(EffectId effectId)
 	{
@@ -197,7 +197,7 @@ namespace EffectManager
 		Effect *pointerEffect = &effects[effectId];
 		
 		// Generate the graphic effect
-		_animatedTexturesList.push_front(new AnimatedTextureStaticEntity(x, y, TextureManager::createAnimatedTextureFromId(pointerEffect->textureId, false)));
+		_animatedTextures.push_back(new AnimatedTextureStaticEntity(x, y, TextureManager::createAnimatedTextureFromId(pointerEffect->textureId, false)));
 		
 		// Play audio effect
 		AudioManager::playSound(pointerEffect->soundId, soundSourceAngle, soundSourceDistance);
@@ -205,33 +205,36 @@ namespace EffectManager
 
 	void clearAllEffects()
 	{
-		std::list<AnimatedTextureStaticEntity *>::iterator animatedTexturesListIterator;
-		for (animatedTexturesListIterator = _animatedTexturesList.begin(); animatedTexturesListIterator != _animatedTexturesList.end(); ++animatedTexturesListIterator) delete *animatedTexturesListIterator;
-		_animatedTexturesList.clear();
+		// Effects are level objects, their memory is released with all other level objects
+		_animatedTextures.clear();
 	}
 
 	void update()
 	{
-		std::list<AnimatedTextureStaticEntity *>::iterator animatedTexturesListIterator = _animatedTexturesList.begin();
 		AnimatedTextureStaticEntity *pointerAnimatedTextureStaticEntity;
-		while (animatedTexturesListIterator != _animatedTexturesList.end())
+		size_t i, keptAnimatedTexturesCount = 0;
+		
+		// Remove finished animations while keeping the order of the remaining ones
+		for (i = 0; i < _animatedTextures.size(); i++)
 		{
-			pointerAnimatedTextureStaticEntity = *animatedTexturesListIterator;
+			pointerAnimatedTextureStaticEntity = _animatedTextures[i];
 			
-			if (pointerAnimatedTextureStaticEntity->update() != 0)
+			// Remove the texture
+			if (pointerAnimatedTextureStaticEntity->update() != 0) delete pointerAnimatedTextureStaticEntity;
+			// Animation is not finished, keep it
+			else
 			{
-				// Remove the texture
-				delete pointerAnimatedTextureStaticEntity;
-				animatedTexturesListIterator = _animatedTexturesList.erase(animatedTexturesListIterator);
+				_animatedTextures[keptAnimatedTexturesCount] = pointerAnimatedTextureStaticEntity;
+				keptAnimatedTexturesCount++;
 			}
-			// Animation is not finished, check next one
-			else ++animatedTexturesListIterator;
 		}
+		_animatedTextures.resize(keptAnimatedTexturesCount);
 	}
 
-	void render()
+	void addToSnapshot()
 	{
-		std::list<AnimatedTextureStaticEntity *>::iterator animatedTexturesListIterator;
-		for (animatedTexturesListIterator = _animatedTexturesList.begin(); animatedTexturesListIterator != _animatedTexturesList.end(); ++animatedTexturesListIterator) (*animatedTexturesListIterator)->render();
+		// Display the newest animations first, so the oldest ones are on top
+		std::vector<AnimatedTextureStaticEntity *>::reverse_iterator animatedTexturesIterator;
+		for (animatedTexturesIterator = _animatedTextures.rbegin(); animatedTexturesIterator != _animatedTextures.rend(); ++animatedTexturesIterator) (*animatedTexturesIterator)->addToSnapshot();
 	}
 }
@@ -4,7 +4,8 @@
  */
 #include <AnimatedTextureStaticEntity.hpp>
 #include <AudioManager.hpp>
-#include <BulletMovingEntity.hpp>
+#include <BulletStore.hpp>
+#include <CollisionManager.hpp>
 #include <Configuration.hpp>
 #include <cstdlib>
 #include <EnemyFightingEntity.hpp>
@@ -12,6 +13,7 @@
 #include <Log.hpp>
 #include <PlayerFightingEntity.hpp>
 #include <Renderer.hpp>
+#include <SnapshotManager.hpp>
 #include <TextureManager.hpp>
 
 EnemyFightingEntity::EnemyFightingEntity(int x, int y, TextureManager::TextureId textureId, int movingPixelsAmount, int maximumLifePointsAmount, int timeBetweenShots, TextureManager::TextureId bulletTextureId, EffectManager::EffectId firingEffectId, EffectManager::EffectId explosionEffectId): FightingEntity(x, y, textureId, movingPixelsAmount, maximumLifePointsAmount, timeBetweenShots, bulletTextureId, firingEffectId)
@@ -28,6 +30,10 @@ EnemyFightingEntity::EnemyFightingEntity(int x, int y, TextureManager::TextureId
 	// Cache effects
 	_explosionEffectId = explosionEffectId;
 	
+	// A new enemy does nothing until it decides to
+	_decision = DECISION_STAY;
+	_decidedFacingDirection = _facingDirection;
+	
 	// Get a bullet width
 	Texture *pointerBulletTexture = TextureManager::getTextureFromId(bulletTextureId); // Use textures to avoid instantiate a bullet to get its dimensions
 	int bulletWidth = pointerBulletTexture->getWidth();
@@ -56,9 +62,15 @@ EnemyFightingEntity::EnemyFightingEntity(int x, int y, TextureManager::TextureId
 	
 	// Set block under enemy center as containing an enemy
 	_setBlockEnemyContent(1);
+	
+	// Allow bullets to find the enemy
+	CollisionManager::addEntity(CollisionManager::GRID_ID_ENEMIES, this);
 }
 
-EnemyFightingEntity::~EnemyFightingEntity() {}
+EnemyFightingEntity::~EnemyFightingEntity()
+{
+	CollisionManager::removeEntity(this);
+}
 
 void EnemyFightingEntity::setX(int x)
 {
@@ -68,6 +80,9 @@ void EnemyFightingEntity::setX(int x)
 	
 	// Adjust position rectangles
 	MovingEntity::setX(x);
+	
+	// Update the collision grid cell
+	CollisionManager::updateEntity(this);
 }
 
 void EnemyFightingEntity::setY(int y)
@@ -78,6 +93,9 @@ void EnemyFightingEntity::setY(int y)
 	
 	// Adjust position rectangles
 	MovingEntity::setY(y);
+	
+	// Update the collision grid cell
+	CollisionManager::updateEntity(this);
 }
 
 int EnemyFightingEntity::moveToUp()
@@ -87,6 +105,7 @@ int EnemyFightingEntity::moveToUp()
 	int movedPixelsAmount = MovingEntity::moveToUp();
 	// Set enemy presence in new block
 	_setBlockEnemyContent(1);
+	CollisionManager::updateEntity(this);
 	
 	// Adjust rectangles coordinates to take this move into account
 	_spottingRectangle.y -= movedPixelsAmount;
@@ -102,6 +121,7 @@ int EnemyFightingEntity::moveToDown()
 	int movedPixelsAmount = MovingEntity::moveToDown();
 	// Set enemy presence in new block
 	_setBlockEnemyContent(1);
+	CollisionManager::updateEntity(this);
 	
 	// Adjust rectangles coordinates to take this move into account
 	_spottingRectangle.y += movedPixelsAmount;
@@ -117,6 +137,7 @@ int EnemyFightingEntity::moveToLeft()
 	int movedPixelsAmount = MovingEntity::moveToLeft();
 	// Set enemy presence in new block
 	_setBlockEnemyContent(1);
+	CollisionManager::updateEntity(this);
 	
 	// Adjust rectangles coordinates to take this move into account
 	_spottingRectangle.x -= movedPixelsAmount;
@@ -132,6 +153,7 @@ int EnemyFightingEntity::moveToRight()
 	int movedPixelsAmount = MovingEntity::moveToRight();
 	// Set enemy presence in new block
 	_setBlockEnemyContent(1);
+	CollisionManager::updateEntity(this);
 	
 	// Adjust rectangles coordinates to take this move into account
 	_spottingRectangle.x += movedPixelsAmount;
@@ -140,104 +162,123 @@ int EnemyFightingEntity::moveToRight()
 	return movedPixelsAmount;
 }
 
-int EnemyFightingEntity::update()
+void EnemyFightingEntity::decide()
 {
-	// The entity is dead, remove it
+	// The enemy is turned only when the decision is carried out, as the position rectangle depends on the facing direction
+	_decidedFacingDirection = _facingDirection;
+	
+	// The entity is dead, it will be removed
 	if (_lifePointsAmount == 0)
 	{
-		// Remove enemy presence from the block
-		_setBlockEnemyContent(0);
-		
-		// Display explosion
-		int soundEmitterAngle = 0, soundEmitterDistance = 0, entityX = this->getX(), entityY = this->getY();
-		AudioManager::computePositionFromCamera(entityX + _pointerTextures[0]->getWidth() / 2, entityY + _pointerTextures[0]->getHeight() / 2, &soundEmitterAngle, &soundEmitterDistance);
-		EffectManager::addEffect(entityX, entityY, _explosionEffectId, soundEmitterAngle, soundEmitterDistance);
-		
-		return 1;
+		_decision = DECISION_DIE;
+		return;
 	}
 	
 	// Nothing to do if the player is not spotted
-	if (!SDL_HasIntersection(pointerPlayer->getPositionRectangle(), &_spottingRectangle)) return 0;
+	_decision = DECISION_STAY;
+	if (!SDL_HasIntersection(pointerPlayer->getPositionRectangle(), &_spottingRectangle)) return;
 	
 	// Shoot if the player is at sight
-	if (_isShootPossible()) return 2;
+	if (_isShootPossible())
+	{
+		_decision = DECISION_SHOOT;
+		return;
+	}
 	
-	// If the enemy can't shoot, it must move to come close enough to the player
-	Direction playerDirection;
-	if (!_getPlayerDirection(&playerDirection)) // The best direction is the one to reach the player
+	// If the enemy can't shoot, it must move to come close enough to the player, follow the shortest way to the player until the enemy is next to the player block
+	SDL_Rect *pointerPositionRectangle = &_positionRectangles[_decidedFacingDirection];
+	if (LevelManager::getPlayerPathDirection(pointerPositionRectangle->x + (pointerPositionRectangle->w / 2), pointerPositionRectangle->y + (pointerPositionRectangle->h / 2), &_decidedDirection) > 1)
+	{
+		_decision = DECISION_FOLLOW_PLAYER_PATH;
+		return;
+	}
+	
+	// Aim at the player when the enemy is close to the player or when the player can't be reached
+	if (!_getPlayerDirection(&_decidedDirection)) // The best direction is the one to reach the player
 	{
 		LOG_DEBUG("Enemy can't shoot but can't move either.");
-		return 0;
+		return;
 	}
+	_decision = DECISION_MOVE_TO_PLAYER;
+}
+
+int EnemyFightingEntity::update()
+{
+	int movedPixelsAmount;
 	
-	// Try to move in the best direction
-	int movedPixelsAmount = move(playerDirection);
-	if (movedPixelsAmount > 0) _isReplacementDirectionChosen = 0; // Enemy can move in its preferred direction, no need to use a replacement one
-	else
+	// Face the player if the enemy decided to
+	_facingDirection = _decidedFacingDirection;
+	
+	switch (_decision)
 	{
-		// Choose a replacement direction different from the best one (which is obstructed by a wall)
-		if (!_isReplacementDirectionChosen)
+		case DECISION_DIE:
 		{
-			do
-			{
-				_replacementDirection = (Direction) (rand() % DIRECTIONS_COUNT);
-			} while (_replacementDirection == playerDirection);
+			// Remove enemy presence from the block
+			_setBlockEnemyContent(0);
+			
+			// Display explosion
+			int soundEmitterAngle = 0, soundEmitterDistance = 0, entityX = this->getX(), entityY = this->getY();
+			AudioManager::computePositionFromCamera(entityX + _pointerTextures[0]->getWidth() / 2, entityY + _pointerTextures[0]->getHeight() / 2, &soundEmitterAngle, &soundEmitterDistance);
+			EffectManager::addEffect(entityX, entityY, _explosionEffectId, soundEmitterAngle, soundEmitterDistance);
+			
+			return 1;
 		}
-		
-		// Try to move in the chosen direction
-		movedPixelsAmount = move(_replacementDirection);
-		if (movedPixelsAmount == 0) _isReplacementDirectionChosen = 0; // There is a wall here too... More luck next tick ! TODO : for loop to make sure all enemies move at each tick ?
-		else _isReplacementDirectionChosen = 1;
+			
+		case DECISION_SHOOT:
+			return 2;
+			
+		case DECISION_FOLLOW_PLAYER_PATH:
+			// A wall corner prevents the enemy from entering the next block, move to the block center line (if the next block is occupied by another enemy, just wait for it to go away)
+			if (move(_decidedDirection) == 0)
+			{
+				Direction alignmentDirection;
+				if (_getBlockAlignmentDirection(_decidedDirection, &alignmentDirection)) move(alignmentDirection);
+			}
+			_isReplacementDirectionChosen = 0;
+			return 0;
+			
+		case DECISION_MOVE_TO_PLAYER:
+			// Try to move in the best direction
+			movedPixelsAmount = move(_decidedDirection);
+			if (movedPixelsAmount > 0) _isReplacementDirectionChosen = 0; // Enemy can move in its preferred direction, no need to use a replacement one
+			else
+			{
+				// Choose a replacement direction different from the best one (which is obstructed by a wall)
+				if (!_isReplacementDirectionChosen)
+				{
+					do
+					{
+						_replacementDirection = (Direction) (rand() % DIRECTIONS_COUNT);
+					} while (_replacementDirection == _decidedDirection);
+				}
+				
+				// Try to move in the chosen direction
+				movedPixelsAmount = move(_replacementDirection);
+				if (movedPixelsAmount == 0) _isReplacementDirectionChosen = 0; // There is a wall here too... More luck next tick ! TODO : for loop to make sure all enemies move at each tick ?
+				else _isReplacementDirectionChosen = 1;
+			}
+			return 0;
+			
+		default:
+			return 0;
 	}
-	
-	return 0;
 }
 
-void EnemyFightingEntity::render()
+void EnemyFightingEntity::addToSnapshot()
 {
-	MovingEntity::render();
+	MovingEntity::addToSnapshot();
 	
 	// Display the various rectangles in debug mode
 	#if CONFIGURATION_LOG_LEVEL == 3
 	{
 		// Spotting rectangle
-		SDL_SetRenderDrawColor(Renderer::pointerRenderer, 0, 255, 0, 255);
-		
-		SDL_Rect renderingRectangle;
-		renderingRectangle.x = _spottingRectangle.x - Renderer::displayX;
-		renderingRectangle.y = _spottingRectangle.y - Renderer::displayY;
-		renderingRectangle.w = _spottingRectangle.w;
-		renderingRectangle.h = _spottingRectangle.h;
-		SDL_RenderDrawRect(Renderer::pointerRenderer, &renderingRectangle);
+		SnapshotManager::addDebugRectangle(&_spottingRectangle, 0, 255, 0);
 		
 		// Shooting rectangles
-		SDL_SetRenderDrawColor(Renderer::pointerRenderer, 255, 0, 0, 255);
-		
-		renderingRectangle.x = _shootingRectangles[DIRECTION_UP].x - Renderer::displayX;
-		renderingRectangle.y = _shootingRectangles[DIRECTION_UP].y - Renderer::displayY;
-		renderingRectangle.w = _shootingRectangles[DIRECTION_UP].w;
-		renderingRectangle.h = _shootingRectangles[DIRECTION_UP].h;
-		SDL_RenderDrawRect(Renderer::pointerRenderer, &renderingRectangle);
-		
-		renderingRectangle.x = _shootingRectangles[DIRECTION_DOWN].x - Renderer::displayX;
-		renderingRectangle.y = _shootingRectangles[DIRECTION_DOWN].y - Renderer::displayY;
-		renderingRectangle.w = _shootingRectangles[DIRECTION_DOWN].w;
-		renderingRectangle.h = _shootingRectangles[DIRECTION_DOWN].h;
-		SDL_RenderDrawRect(Renderer::pointerRenderer, &renderingRectangle);
-		
-		renderingRectangle.x = _shootingRectangles[DIRECTION_LEFT].x - Renderer::displayX;
-		renderingRectangle.y = _shootingRectangles[DIRECTION_LEFT].y - Renderer::displayY;
-		renderingRectangle.w = _shootingRectangles[DIRECTION_LEFT].w;
-		renderingRectangle.h = _shootingRectangles[DIRECTION_LEFT].h;
-		SDL_RenderDrawRect(Renderer::pointerRenderer, &renderingRectangle);
-		
-		renderingRectangle.x = _shootingRectangles[DIRECTION_RIGHT].x - Renderer::displayX;
-		renderingRectangle.y = _shootingRectangles[DIRECTION_RIGHT].y - Renderer::displayY;
-		renderingRectangle.w = _shootingRectangles[DIRECTION_RIGHT].w;
-		renderingRectangle.h = _shootingRectangles[DIRECTION_RIGHT].h;
-		SDL_RenderDrawRect(Renderer::pointerRenderer, &renderingRectangle);
-		
-		SDL_SetRenderDrawColor(Renderer::pointerRenderer, 0, 0, 0, 255);
+		SnapshotManager::addDebugRectangle(&_shootingRectangles[DIRECTION_UP], 255, 0, 0);
+		SnapshotManager::addDebugRectangle(&_shootingRectangles[DIRECTION_DOWN], 255, 0, 0);
+		SnapshotManager::addDebugRectangle(&_shootingRectangles[DIRECTION_LEFT], 255, 0, 0);
+		SnapshotManager::addDebugRectangle(&_shootingRectangles[DIRECTION_RIGHT], 255, 0, 0);
 	}
 	#endif
 }
@@ -252,7 +293,7 @@ int EnemyFightingEntity::_isShootPossible()
 		{
 			if (!LevelManager::isObstaclePresentOnVerticalAxis(pointerPlayer->getY(), getY(), getX())) return 1;
 		}
-		else turnToUp(); // Face right direction
+		else _decidedFacingDirection = DIRECTION_UP; // Face right direction
 	}
 	else if (SDL_HasIntersection(pointerPlayer->getPositionRectangle(), &_shootingRectangles[DIRECTION_DOWN]))
 	{
@@ -260,7 +301,7 @@ int EnemyFightingEntity::_isShootPossible()
 		{
 			if (!LevelManager::isObstaclePresentOnVerticalAxis(getY(), pointerPlayer->getY(), getX())) return 1;
 		}
-		else turnToDown();
+		else _decidedFacingDirection = DIRECTION_DOWN;
 	}
 	else if (SDL_HasIntersection(pointerPlayer->getPositionRectangle(), &_shootingRectangles[DIRECTION_LEFT]))
 	{
@@ -268,7 +309,7 @@ int EnemyFightingEntity::_isShootPossible()
 		{
 			if (!LevelManager::isObstaclePresentOnHorizontalAxis(pointerPlayer->getX(), getX(), getY())) return 1;
 		}
-		else turnToLeft();
+		else _decidedFacingDirection = DIRECTION_LEFT;
 	}
 	else if (SDL_HasIntersection(pointerPlayer->getPositionRectangle(), &_shootingRectangles[DIRECTION_RIGHT]))
 	{
@@ -276,7 +317,7 @@ int EnemyFightingEntity::_isShootPossible()
 		{
 			if (!LevelManager::isObstaclePresentOnHorizontalAxis(getX(), pointerPlayer->getX(), getY())) return 1;
 		}
-		else turnToRight();
+		else _decidedFacingDirection = DIRECTION_RIGHT;
 	}
 	
 	return 0;
@@ -287,7 +328,7 @@ int EnemyFightingEntity::_getPlayerDirection(Direction *pointerDirection)
 	// Compute both player and enemy centers
 	SDL_Rect *pointerPlayerPositionRectangle, *pointerEnemyPositionRectangle;
 	pointerPlayerPositionRectangle = pointerPlayer->getPositionRectangle();
-	pointerEnemyPositionRectangle = &_positionRectangles[_facingDirection];
+	pointerEnemyPositionRectangle = &_positionRectangles[_decidedFacingDirection];
 	int enemyCenterX = pointerEnemyPositionRectangle->x + (pointerEnemyPositionRectangle->w / 2);
 	int enemyCenterY = pointerEnemyPositionRectangle->y + (pointerEnemyPositionRectangle->h / 2);
 	
@@ -333,6 +374,45 @@ int EnemyFightingEntity::_getPlayerDirection(Direction *pointerDirection)
 	return 0;
 }
 
+int EnemyFightingEntity::_getBlockAlignmentDirection(Direction movingDirection, Direction *pointerDirection)
+{
+	SDL_Rect *pointerPositionRectangle = &_positionRectangles[_facingDirection];
+	int blockX, blockY;
+	
+	// Moving vertically, the enemy must fit in the block columns
+	if ((movingDirection == DIRECTION_UP) || (movingDirection == DIRECTION_DOWN))
+	{
+		blockX = ((pointerPositionRectangle->x + (pointerPositionRectangle->w / 2)) / CONFIGURATION_LEVEL_BLOCK_SIZE) * CONFIGURATION_LEVEL_BLOCK_SIZE;
+		if (pointerPositionRectangle->x < blockX)
+		{
+			*pointerDirection = DIRECTION_RIGHT;
+			return 1;
+		}
+		if (pointerPositionRectangle->x + pointerPositionRectangle->w > blockX + CONFIGURATION_LEVEL_BLOCK_SIZE)
+		{
+			*pointerDirection = DIRECTION_LEFT;
+			return 1;
+		}
+	}
+	// Moving horizontally, the enemy must fit in the block row
+	else
+	{
+		blockY = ((pointerPositionRectangle->y + (pointerPositionRectangle->h / 2)) / CONFIGURATION_LEVEL_BLOCK_SIZE) * CONFIGURATION_LEVEL_BLOCK_SIZE;
+		if (pointerPositionRectangle->y < blockY)
+		{
+			*pointerDirection = DIRECTION_DOWN;
+			return 1;
+		}
+		if (pointerPositionRectangle->y + pointerPositionRectangle->h > blockY + CONFIGURATION_LEVEL_BLOCK_SIZE)
+		{
+			*pointerDirection = DIRECTION_UP;
+			return 1;
+		}
+	}
+	
+	return 0;
+}
+
 void EnemyFightingEntity::_setBlockEnemyContent(bool isEnemyPresent)
 {
 	// Cache enemy center coordinates
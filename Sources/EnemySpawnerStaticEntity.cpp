@@ -3,35 +3,48 @@
  * @author Adrien RICCIARDI
  */
 #include <AudioManager.hpp>
+#include <CollisionManager.hpp>
+#include <Configuration.hpp>
 #include <EffectManager.hpp>
 #include <EnemySpawnerStaticEntity.hpp>
-#include <Renderer.hpp>
+#include <ObjectPool.hpp>
+#include <SnapshotManager.hpp>
 #include <TextureManager.hpp>
 
+/** All enemy spawners memory. */
+static ObjectPool<EnemySpawnerStaticEntity, CONFIGURATION_OBJECT_POOL_ENEMY_SPAWNERS_COUNT> _pool("enemy spawners");
+
 EnemySpawnerStaticEntity::EnemySpawnerStaticEntity(int x, int y): StaticEntity(x, y, TextureManager::getTextureFromId(TextureManager::TEXTURE_ID_ENEMY_SPAWNER))
 {
 	_lifePointsAmount = 10;
 	
 	// Create the looped teleportation animation
 	_pointerEffectTexture = TextureManager::createAnimatedTextureFromId(TextureManager::TEXTURE_ID_ENEMY_SPAWNER_TELEPORTATION_EFFECT, true);
+	
+	// Allow bullets to find the spawner
+	CollisionManager::addEntity(CollisionManager::GRID_ID_ENEMY_SPAWNERS, this);
 }
 
 EnemySpawnerStaticEntity::~EnemySpawnerStaticEntity()
 {
+	CollisionManager::removeEntity(this);
 	delete _pointerEffectTexture;
 }
 
-void EnemySpawnerStaticEntity::render()
+void EnemySpawnerStaticEntity::addToSnapshot()
 {
 	// Display spawner
-	StaticEntity::render();
+	StaticEntity::addToSnapshot();
 	
 	// Display teleportation effect
-	_pointerEffectTexture->render(_positionRectangle.x - Renderer::displayX + 15, _positionRectangle.y - Renderer::displayY + 15);
+	SnapshotManager::addSprite(_pointerEffectTexture, _positionRectangle.x + 15, _positionRectangle.y + 15, _positionRectangle.x + 15, _positionRectangle.y + 15);
 }
 
 int EnemySpawnerStaticEntity::update()
 {
+	// Make the teleportation effect progress (it is looping, so it never ends)
+	_pointerEffectTexture->update();
+	
 	// Remove the spawner if it is destroyed
 	if (_lifePointsAmount == 0)
 	{
@@ -51,3 +64,13 @@ int EnemySpawnerStaticEntity::update()
 	
 	return 0;
 }
+
+void *EnemySpawnerStaticEntity::operator new(size_t size)
+{
+	return _pool.allocate(size);
+}
+
+void EnemySpawnerStaticEntity::operator delete(void *pointerObject)
+{
+	_pool.release(pointerObject);
+}
@@ -5,6 +5,7 @@
 #include <AudioManager.hpp>
 #include <FightingEntity.hpp>
 #include <LevelManager.hpp>
+#include <TimeManager.hpp>
 
 FightingEntity::FightingEntity(int x, int y, TextureManager::TextureId textureId, int movingPixelsAmount, int maximumLifePointsAmount, int timeBetweenShots, TextureManager::TextureId facingUpBulletTextureId, EffectManager::EffectId firingEffectId): MovingEntity(x, y, textureId, movingPixelsAmount)
 {
@@ -16,7 +17,7 @@ FightingEntity::FightingEntity(int x, int y, TextureManager::TextureId textureId
 	_collisionBlockContent = LevelManager::BLOCK_CONTENT_WALL | LevelManager::BLOCK_CONTENT_ENEMY_SPAWNER;
 	
 	// Cache the offset to add to entity coordinates to make fired bullets start from where the cannon is (bullets are spawned a little nearer from the entity center than the cannon muzzle, so an underneath entity can be hit)
-	// Warning : for the underneath entity to be killed, bullet speed must be less than the bullet texture's larger dimension
+	// The whole area a bullet went through is checked against the entities, so the underneath entity is hit whatever the bullet speed is
 	Texture *pointerBulletTexture = TextureManager::getTextureFromId(facingUpBulletTextureId); // Use textures to avoid instantiate a bullet to get its dimensions
 	_computeBulletStartingPositionOffsets(_pointerTextures[DIRECTION_UP], pointerBulletTexture, _bulletStartingPositionOffsets);
 	
@@ -24,7 +25,7 @@ FightingEntity::FightingEntity(int x, int y, TextureManager::TextureId textureId
 	_computeFiringEffectStartingPositionOffsets(_pointerTextures[DIRECTION_UP], firingEffectId, _firingEffectStartingPositionOffsets);
 	
 	_timeBetweenShots = timeBetweenShots;
-	_lastShotTime = 0; // Allow to shoot immediately
+	_lastShotTime = -timeBetweenShots; // Allow to shoot immediately
 }
 
 FightingEntity::~FightingEntity() {}
@@ -40,10 +41,10 @@ bool FightingEntity::modifyLife(int lifePointsAmount)
 	return true;
 }
 
-BulletMovingEntity *FightingEntity::shoot()
+bool FightingEntity::shoot(BulletStore *pointerBulletStore)
 {
 	// Allow to shoot only if enough time elapsed since last shot
-	if (SDL_GetTicks() - _lastShotTime >= _timeBetweenShots)
+	if (TimeManager::getTicks() - _lastShotTime >= _timeBetweenShots)
 	{
 		// Cache entity coordinates
 		int entityX = _positionRectangles[_facingDirection].x;
@@ -56,7 +57,7 @@ BulletMovingEntity *FightingEntity::shoot()
 		int firingEffectStartingPositionOffsetY = _firingEffectStartingPositionOffsets[_facingDirection].y;
 		
 		// Create the bullet
-		BulletMovingEntity *pointerBullet = _fireBullet(entityX + bulletStartingPositionOffsetX, entityY + bulletStartingPositionOffsetY);
+		_fireBullet(pointerBulletStore, entityX + bulletStartingPositionOffsetX, entityY + bulletStartingPositionOffsetY);
 		
 		// Play the shoot effect
 		int soundEmitterAngle = 0, soundEmitterDistance = 0;
@@ -64,12 +65,12 @@ BulletMovingEntity *FightingEntity::shoot()
 		EffectManager::EffectId muzzleFlashEffectId = (EffectManager::EffectId) ((int) _firingEffectId + (int) _facingDirection); // Select the right effect according to entity direction
 		EffectManager::addEffect(entityX + firingEffectStartingPositionOffsetX, entityY + firingEffectStartingPositionOffsetY, muzzleFlashEffectId, soundEmitterAngle, soundEmitterDistance);
 		
-		// Get time after having generated the bullet, in case this takes more than 1 millisecond
-		_lastShotTime = SDL_GetTicks();
+		// Start the reloading delay
+		_lastShotTime = TimeManager::getTicks();
 		
-		return pointerBullet;
+		return true;
 	}
-	return NULL; // No shot allowed
+	return false; // No shot allowed
 }
 
 void FightingEntity::_computeBulletStartingPositionOffsets(Texture *pointerEntityTexture, Texture *pointerFacingUpBulletTexture, SDL_Point *pointerPositionOffsets)
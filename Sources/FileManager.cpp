@@ -2,10 +2,17 @@
  * See FileManager.hpp for description.
  * @author Adrien RICCIARDI
  */
+#include <cerrno>
 #include <cstring>
 #include <FileManager.hpp>
 #include <Log.hpp>
 #include <SDL2/SDL.h>
+#ifndef _WIN32
+	#include <fcntl.h>
+	#include <sys/mman.h>
+	#include <sys/stat.h>
+	#include <unistd.h>
+#endif
 
 namespace FileManager
 {
@@ -49,7 +56,7 @@ namespace FileManager
 	const char *getFilePath(const char *pointerStringFileName)
 	{
 		#ifdef CONFIGURATION_BUILD_FOR_MACOS
-			static char stringPath[16384];
+			static thread_local char stringPath[16384]; // Levels are loaded from a separate thread, so each thread needs its own buffer
 			
 			// Build the path
 			strcpy(stringPath, stringBasePath); // Base path has always a terminating separator (this is specified by SDL documentation)
@@ -59,4 +66,62 @@ namespace FileManager
 			return pointerStringFileName;
 		#endif
 	}
+
+	const void *mapFile(const char *pointerStringFilePath, size_t *pointerFileSize)
+	{
+		#ifdef _WIN32
+			// Windows has no mmap(), load the whole file instead
+			void *pointerFileContent = SDL_LoadFile(pointerStringFilePath, pointerFileSize);
+			if (pointerFileContent == NULL) LOG_DEBUG("Could not load '%s' (%s).", pointerStringFilePath, SDL_GetError());
+			return pointerFileContent;
+		#else
+			int fileDescriptor;
+			struct stat fileStatus;
+			void *pointerFileContent;
+			
+			// Try to open the file
+			fileDescriptor = open(pointerStringFilePath, O_RDONLY);
+			if (fileDescriptor == -1)
+			{
+				LOG_DEBUG("Could not open '%s' (%s).", pointerStringFilePath, strerror(errno));
+				return NULL;
+			}
+			
+			// Retrieve the file size
+			if (fstat(fileDescriptor, &fileStatus) != 0)
+			{
+				LOG_ERROR("Could not retrieve '%s' size (%s).", pointerStringFilePath, strerror(errno));
+				close(fileDescriptor);
+				return NULL;
+			}
+			if (fileStatus.st_size == 0) // mmap() fails with an empty file
+			{
+				LOG_ERROR("File '%s' is empty.", pointerStringFilePath);
+				close(fileDescriptor);
+				return NULL;
+			}
+			
+			// Map the whole file, the descriptor is not needed anymore once the mapping exists
+			pointerFileContent = mmap(NULL, fileStatus.st_size, PROT_READ, MAP_PRIVATE, fileDescriptor, 0);
+			close(fileDescriptor);
+			if (pointerFileContent == MAP_FAILED)
+			{
+				LOG_ERROR("Could not map '%s' to memory (%s).", pointerStringFilePath, strerror(errno));
+				return NULL;
+			}
+			
+			*pointerFileSize = fileStatus.st_size;
+			return pointerFileContent;
+		#endif
+	}
+
+	void unmapFile(const void *pointerFileContent, size_t fileSize)
+	{
+		#ifdef _WIN32
+			(void) fileSize; // The size is needed only by munmap()
+			SDL_free(const_cast<void *>(pointerFileContent));
+		#else
+			munmap(const_cast<void *>(pointerFileContent), fileSize);
+		#endif
+	}
 }
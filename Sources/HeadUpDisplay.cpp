@@ -32,142 +32,138 @@ namespace HeadUpDisplay
 		Texture *pointerLightedTexture; //!< The texture to display when the arrow is lighted.
 		int x; //!< The texture displaying horizontal coordinate.
 		int y; //!< The texture displaying vertical coordinate.
-		bool isLighted; //!< Display lighted texture when true, display turned off texture when false.
 	} CompassArrow;
 
-	/** Cache all the pre-rendered string textures to avoid to render them at each frame, which is useless if they don't change. */
-	static SDL_Texture *_pointerStringTextures[STRING_IDS_COUNT] = {0};
+	/** All HUD parts that are drawn independently. */
+	typedef enum
+	{
+		WIDGET_ID_PANEL, //!< The background and all strings displayed on it.
+		WIDGET_ID_REMAINING_BONUS_TIME,
+		WIDGET_ID_FIRST_COMPASS_ARROW, //!< Each compass arrow is a widget, their identifiers follow the compass arrows order.
+		WIDGET_IDS_COUNT = WIDGET_ID_FIRST_COMPASS_ARROW + COMPASS_ARROW_IDS_COUNT
+	} WidgetId;
 
-	/** Point to the interface background texture with the right type for the rendering function. */
-	static SDL_Texture *_pointerBackgroundTexture;
+	/** A HUD part drawn to the HUD texture. */
+	typedef struct
+	{
+		bool isDirty; //!< Tell whether the widget must be drawn again to the HUD texture.
+		SDL_Rect area; //!< The HUD texture area the widget has been drawn to (its size is zero if nothing has been drawn).
+	} Widget;
 
-	/** Tell whether bonus remaining time must be displayed. */
-	static bool _isBonusRemainingSecondsStringDisplayed = false;
+	/** A string to display and its color. */
+	typedef struct
+	{
+		char string[64]; //!< The text.
+		Renderer::TextColorId colorId; //!< The text color.
+	} InterfaceString;
+
+	/** Cache all the formatted strings to avoid to format them at each frame, which is useless if they don't change. */
+	static InterfaceString _strings[STRING_IDS_COUNT];
+
+	/** Cache the interface background texture. */
+	static Texture *_pointerBackgroundTexture;
 
 	/** All compass arrows. */
 	static CompassArrow _compassArrows[COMPASS_ARROW_IDS_COUNT];
 
-	/** Display player life amount. */
-	static inline void _displayPlayerLifePointsAmount()
-	{
-		// Check whether the string must be rendered
-		static int previousLifePointsAmount = -10; // This value can't be reached in game, so the string displaying is forced on game start
-		int lifePointsAmount = pointerPlayer->getLifePointsAmount();
-		if (lifePointsAmount != previousLifePointsAmount)
-		{
-			// Display life points in red if the player is near to death
-			Renderer::TextColorId colorId;
-			if (lifePointsAmount < 20) colorId = Renderer::TEXT_COLOR_ID_RED;
-			// Display life points in green if the player life is full
-			else if (lifePointsAmount == pointerPlayer->getMaximumLifePointsAmount()) colorId = Renderer::TEXT_COLOR_ID_GREEN;
-			else colorId = Renderer::TEXT_COLOR_ID_LIGHT_BLUE;
-			
-			// Free previous string
-			SDL_DestroyTexture(_pointerStringTextures[STRING_ID_LIFE_POINTS_AMOUNT]); // SDL_DestroyTexture() does not complain if the provided pointer is NULL, as it is on the first frame
-			
-			// Render the string
-			char string[64];
-			sprintf(string, "Life : %d", lifePointsAmount);
-			_pointerStringTextures[STRING_ID_LIFE_POINTS_AMOUNT] = Renderer::renderTextToTexture(string, colorId, Renderer::FONT_SIZE_ID_SMALL);
-			
-			previousLifePointsAmount = lifePointsAmount;
-			LOG_DEBUG("Refreshed life points interface string.");
-		}
-		
-		// Render the string
-		Renderer::renderTexture(_pointerStringTextures[STRING_ID_LIFE_POINTS_AMOUNT], CONFIGURATION_DISPLAY_HUD_LIFE_POINTS_X, CONFIGURATION_DISPLAY_HUD_LIFE_POINTS_Y);
-	}
+	/** The values provided by the game logic. */
+	static State _state;
+	/** The values the cached strings have been formatted from. */
+	static State _renderedState;
+
+	/** All widgets. */
+	static Widget _widgets[WIDGET_IDS_COUNT];
+	/** The whole HUD is drawn to this display-sized texture, which is updated only when a widget changes. It is NULL if the renderer does not support render targets (all widgets are directly displayed at each frame in this case). */
+	static SDL_Texture *_pointerHeadUpDisplayTexture = NULL;
+	/** Tell whether the HUD texture content has been lost and must be fully drawn again. */
+	static bool _isHeadUpDisplayTextureReset;
 
-	static inline void _displayPlayerAmmunitionAmount()
+	/** Format the player life amount string again if needed.
+	 * @param pointerState The values to display.
+	 */
+	static inline void _updatePlayerLifePointsAmountString(const State *pointerState)
 	{
-		// Check whether the string must be rendered
-		static int previousAmmunitionAmount = -10; // This value can't be reached in game, so the string displaying is forced on game start
-		int ammunitionAmount = pointerPlayer->getAmmunitionAmount();
-		if (ammunitionAmount != previousAmmunitionAmount)
-		{
-			// Display ammunition in red if they are exhausted
-			Renderer::TextColorId colorId;
-			if (ammunitionAmount == 0) colorId = Renderer::TEXT_COLOR_ID_RED;
-			else colorId = Renderer::TEXT_COLOR_ID_LIGHT_BLUE;
-			
-			// Free previous string
-			SDL_DestroyTexture(_pointerStringTextures[STRING_ID_AMMUNITION_AMOUNT]);
-			
-			// Render the string
-			char string[64];
-			sprintf(string, "Ammo : %d", ammunitionAmount);
-			_pointerStringTextures[STRING_ID_AMMUNITION_AMOUNT] = Renderer::renderTextToTexture(string, colorId, Renderer::FONT_SIZE_ID_SMALL);
-			
-			previousAmmunitionAmount = ammunitionAmount;
-			LOG_DEBUG("Refreshed ammunition interface string.");
-		}
+		// Check whether the string must be formatted
+		int lifePointsAmount = pointerState->lifePointsAmount;
+		if (lifePointsAmount == _renderedState.lifePointsAmount) return;
 		
-		// Render the string
-		Renderer::renderTexture(_pointerStringTextures[STRING_ID_AMMUNITION_AMOUNT], CONFIGURATION_DISPLAY_HUD_AMMUNITION_X, CONFIGURATION_DISPLAY_HUD_AMMUNITION_Y);
+		// Display life points in red if the player is near to death
+		Renderer::TextColorId colorId;
+		if (lifePointsAmount < 20) colorId = Renderer::TEXT_COLOR_ID_RED;
+		// Display life points in green if the player life is full
+		else if (lifePointsAmount == pointerState->maximumLifePointsAmount) colorId = Renderer::TEXT_COLOR_ID_GREEN;
+		else colorId = Renderer::TEXT_COLOR_ID_LIGHT_BLUE;
+		
+		// Format the string
+		sprintf(_strings[STRING_ID_LIFE_POINTS_AMOUNT].string, "Life : %d", lifePointsAmount);
+		_strings[STRING_ID_LIFE_POINTS_AMOUNT].colorId = colorId;
+		
+		_renderedState.lifePointsAmount = lifePointsAmount;
+		_widgets[WIDGET_ID_PANEL].isDirty = true;
+		LOG_DEBUG("Refreshed life points interface string.");
 	}
 
-	int initialize()
+	/** Format the player ammunition amount string again if needed.
+	 * @param pointerState The values to display.
+	 */
+	static inline void _updatePlayerAmmunitionAmountString(const State *pointerState)
 	{
-		// Cache background texture access to avoid searching for it at each frame
-		_pointerBackgroundTexture = getTextureFromId(TextureManager::TEXTURE_ID_HEAD_UP_DISPLAY_BACKGROUND)->getSDLTexture();
+		// Check whether the string must be formatted
+		int ammunitionAmount = pointerState->ammunitionAmount;
+		if (ammunitionAmount == _renderedState.ammunitionAmount) return;
 		
-		// Cache compass textures and position
-		// Down arrow
-		_compassArrows[1].pointerTurnedOffTexture = TextureManager::getTextureFromId(TextureManager::TEXTURE_ID_COMPASS_ARROW_DOWN_TURNED_OFF);
-		_compassArrows[1].pointerLightedTexture = TextureManager::getTextureFromId(TextureManager::TEXTURE_ID_COMPASS_ARROW_DOWN_LIGHTED);
-		_compassArrows[1].x = (Renderer::displayWidth - _compassArrows[1].pointerTurnedOffTexture->getWidth()) / 2;
-		_compassArrows[1].y = Renderer::displayHeight - _compassArrows[1].pointerTurnedOffTexture->getHeight() - 20; // Start from downer arrow as it has a fixed vertical position from the screen bottom
-		// Left arrow
-		_compassArrows[2].pointerTurnedOffTexture = TextureManager::getTextureFromId(TextureManager::TEXTURE_ID_COMPASS_ARROW_LEFT_TURNED_OFF);
-		_compassArrows[2].pointerLightedTexture = TextureManager::getTextureFromId(TextureManager::TEXTURE_ID_COMPASS_ARROW_LEFT_LIGHTED);
-		_compassArrows[2].x = ((Renderer::displayWidth - _compassArrows[2].pointerTurnedOffTexture->getWidth()) / 2) - 42;
-		_compassArrows[2].y = _compassArrows[1].y - _compassArrows[2].pointerTurnedOffTexture->getHeight() + 8; // Left arrow vertical position is computed from down arrow position
-		// Right arrow
-		_compassArrows[3].pointerTurnedOffTexture = TextureManager::getTextureFromId(TextureManager::TEXTURE_ID_COMPASS_ARROW_RIGHT_TURNED_OFF);
-		_compassArrows[3].pointerLightedTexture = TextureManager::getTextureFromId(TextureManager::TEXTURE_ID_COMPASS_ARROW_RIGHT_LIGHTED);
-		_compassArrows[3].x = ((Renderer::displayWidth - _compassArrows[2].pointerTurnedOffTexture->getWidth()) / 2) + 42;
-		_compassArrows[3].y = _compassArrows[2].y; // Right arrow vertical position is the same than left arrow
-		// Up arrow
-		_compassArrows[0].pointerTurnedOffTexture = TextureManager::getTextureFromId(TextureManager::TEXTURE_ID_COMPASS_ARROW_UP_TURNED_OFF);
-		_compassArrows[0].pointerLightedTexture = TextureManager::getTextureFromId(TextureManager::TEXTURE_ID_COMPASS_ARROW_UP_LIGHTED);
-		_compassArrows[0].x = (Renderer::displayWidth - _compassArrows[0].pointerTurnedOffTexture->getWidth()) / 2;
-		_compassArrows[0].y = _compassArrows[2].y - _compassArrows[0].pointerTurnedOffTexture->getHeight() + 8;
-
-		return 0;
+		// Display ammunition in red if they are exhausted
+		Renderer::TextColorId colorId;
+		if (ammunitionAmount == 0) colorId = Renderer::TEXT_COLOR_ID_RED;
+		else colorId = Renderer::TEXT_COLOR_ID_LIGHT_BLUE;
+		
+		// Format the string
+		sprintf(_strings[STRING_ID_AMMUNITION_AMOUNT].string, "Ammo : %d", ammunitionAmount);
+		_strings[STRING_ID_AMMUNITION_AMOUNT].colorId = colorId;
+		
+		_renderedState.ammunitionAmount = ammunitionAmount;
+		_widgets[WIDGET_ID_PANEL].isDirty = true;
+		LOG_DEBUG("Refreshed ammunition interface string.");
 	}
 
-	void setEnemiesAmount(int amount)
+	/** Format the enemies amount string again if needed.
+	 * @param pointerState The values to display.
+	 */
+	static inline void _updateEnemiesAmountString(const State *pointerState)
 	{
+		// Check whether the string must be formatted
+		if ((pointerState->enemiesAmount == _renderedState.enemiesAmount) && (pointerState->isLevelCleared == _renderedState.isLevelCleared)) return;
+		
 		// Display enemies in green if they are all dead and all enemy spawners are destroyed
 		Renderer::TextColorId colorId;
-		if ((amount == 0) && (LevelManager::enemySpawnersList.empty())) colorId = Renderer::TEXT_COLOR_ID_GREEN;
+		if (pointerState->isLevelCleared) colorId = Renderer::TEXT_COLOR_ID_GREEN;
 		else colorId = Renderer::TEXT_COLOR_ID_LIGHT_BLUE;
 		
-		// Free previous string
-		SDL_DestroyTexture(_pointerStringTextures[STRING_ID_ENEMIES_AMOUNT]);
-		
-		// Render the string
-		char string[64];
-		sprintf(string, "Enemies : %d", amount);
-		_pointerStringTextures[STRING_ID_ENEMIES_AMOUNT] = Renderer::renderTextToTexture(string, colorId, Renderer::FONT_SIZE_ID_SMALL);
+		// Format the string
+		sprintf(_strings[STRING_ID_ENEMIES_AMOUNT].string, "Enemies : %d", pointerState->enemiesAmount);
+		_strings[STRING_ID_ENEMIES_AMOUNT].colorId = colorId;
 		
+		_renderedState.enemiesAmount = pointerState->enemiesAmount;
+		_renderedState.isLevelCleared = pointerState->isLevelCleared;
+		_widgets[WIDGET_ID_PANEL].isDirty = true;
 		LOG_DEBUG("Refreshed enemies interface string.");
 	}
 
-	void setMortarState(MortarState state)
+	/** Format the mortar state string again if needed.
+	 * @param pointerState The values to display.
+	 */
+	static inline void _updateMortarStateString(const State *pointerState)
 	{
-		static MortarState previousMortarState = MORTAR_STATE_INVALID; // Initialize with an invalid value to make sure the first string is generated
-		
-		// Nothing to do if the string has been rendered yet
-		if (state == previousMortarState) return;
+		// Nothing to do if the string has been formatted yet
+		if (pointerState->mortarState == _renderedState.mortarState) return;
 		
 		// Add string prefix
-		char string[64];
+		char *string = _strings[STRING_ID_MORTAR_STATE].string;
 		strcpy(string, "Mortar : ");
 		
 		// Add string suffix and select color
 		Renderer::TextColorId colorId;
-		switch (state)
+		switch (pointerState->mortarState)
 		{
 			case MORTAR_STATE_LOW_AMMUNITION:
 				colorId = Renderer::TEXT_COLOR_ID_RED;
@@ -185,63 +181,335 @@ namespace HeadUpDisplay
 				break;
 				
 			default:
-				LOG_ERROR("Invalid mortar state : %d.", state);
+				LOG_ERROR("Invalid mortar state : %d.", pointerState->mortarState);
 				exit(-1);
 				break;
 		}
 		
-		// Render the string
-		_pointerStringTextures[STRING_ID_MORTAR_STATE] = Renderer::renderTextToTexture(string, colorId, Renderer::FONT_SIZE_ID_SMALL);
+		_strings[STRING_ID_MORTAR_STATE].colorId = colorId;
 		
-		previousMortarState = state;
+		_renderedState.mortarState = pointerState->mortarState;
+		_widgets[WIDGET_ID_PANEL].isDirty = true;
 	}
 
-	void setRemainingBonusTime(int timeSeconds)
+	/** Format the bonus remaining time string again if needed.
+	 * @param pointerState The values to display.
+	 */
+	static inline void _updateRemainingBonusTimeString(const State *pointerState)
 	{
-		if (timeSeconds == 0)
+		if (pointerState->remainingBonusSeconds == _renderedState.remainingBonusSeconds) return;
+		
+		// The string is not displayed when no bonus is active, but the widget must still be erased
+		if (pointerState->remainingBonusSeconds > 0)
 		{
-			_isBonusRemainingSecondsStringDisplayed = false;
-			return;
+			sprintf(_strings[STRING_ID_REMAINING_BONUS_TIME].string, "Bonus time : %d", pointerState->remainingBonusSeconds);
+			_strings[STRING_ID_REMAINING_BONUS_TIME].colorId = Renderer::TEXT_COLOR_ID_BLUE;
+			LOG_DEBUG("Refreshed bonus timer interface string.");
 		}
 		
-		// Free previous string
-		SDL_DestroyTexture(_pointerStringTextures[STRING_ID_REMAINING_BONUS_TIME]);
+		_renderedState.remainingBonusSeconds = pointerState->remainingBonusSeconds;
+		_widgets[WIDGET_ID_REMAINING_BONUS_TIME].isDirty = true;
+	}
+
+	/** Find the compass arrows that changed state.
+	 * @param pointerState The values to display.
+	 */
+	static inline void _updateCompassArrows(const State *pointerState)
+	{
+		for (int i = 0; i < COMPASS_ARROW_IDS_COUNT; i++)
+		{
+			if (pointerState->isCompassArrowLighted[i] == _renderedState.isCompassArrowLighted[i]) continue;
+			
+			_renderedState.isCompassArrowLighted[i] = pointerState->isCompassArrowLighted[i];
+			_widgets[WIDGET_ID_FIRST_COMPASS_ARROW + i].isDirty = true;
+		}
+	}
+
+	/** Display a string and add its area to a widget area.
+	 * @param stringId The string to display.
+	 * @param fontSizeId The string font size.
+	 * @param x The string horizontal coordinate.
+	 * @param y The string vertical coordinate.
+	 * @param pointerArea On output, the string area is added to this area.
+	 */
+	static void _renderString(StringId stringId, Renderer::FontSizeId fontSizeId, int x, int y, SDL_Rect *pointerArea)
+	{
+		SDL_Rect stringArea;
 		
-		// Render the string
-		char string[64];
-		sprintf(string, "Bonus time : %d", timeSeconds);
-		_pointerStringTextures[STRING_ID_REMAINING_BONUS_TIME] = Renderer::renderTextToTexture(string, Renderer::TEXT_COLOR_ID_BLUE, Renderer::FONT_SIZE_ID_BIG);
+		Renderer::renderText(_strings[stringId].string, _strings[stringId].colorId, fontSizeId, x, y);
 		
-		_isBonusRemainingSecondsStringDisplayed = true;
+		stringArea.x = x;
+		stringArea.y = y;
+		Renderer::getTextSize(_strings[stringId].string, fontSizeId, &stringArea.w, &stringArea.h);
+		SDL_UnionRect(pointerArea, &stringArea, pointerArea);
+	}
+
+	/** Display a widget.
+	 * @param widgetId The widget to display.
+	 * @param pointerState The values to display.
+	 */
+	static void _renderWidget(int widgetId, const State *pointerState)
+	{
+		SDL_Rect *pointerArea = &_widgets[widgetId].area;
+		CompassArrow *pointerCompassArrow;
+		Texture *pointerTexture;
+		int width;
 		
-		LOG_DEBUG("Refreshed bonus timer interface string.");
+		switch (widgetId)
+		{
+			case WIDGET_ID_PANEL:
+				_pointerBackgroundTexture->render(CONFIGURATION_DISPLAY_HUD_BACKGROUND_TEXTURE_X, CONFIGURATION_DISPLAY_HUD_BACKGROUND_TEXTURE_Y);
+				pointerArea->x = CONFIGURATION_DISPLAY_HUD_BACKGROUND_TEXTURE_X;
+				pointerArea->y = CONFIGURATION_DISPLAY_HUD_BACKGROUND_TEXTURE_Y;
+				pointerArea->w = _pointerBackgroundTexture->getWidth();
+				pointerArea->h = _pointerBackgroundTexture->getHeight();
+				
+				// Strings may be wider than the background
+				_renderString(STRING_ID_LIFE_POINTS_AMOUNT, Renderer::FONT_SIZE_ID_SMALL, CONFIGURATION_DISPLAY_HUD_LIFE_POINTS_X, CONFIGURATION_DISPLAY_HUD_LIFE_POINTS_Y, pointerArea);
+				_renderString(STRING_ID_AMMUNITION_AMOUNT, Renderer::FONT_SIZE_ID_SMALL, CONFIGURATION_DISPLAY_HUD_AMMUNITION_X, CONFIGURATION_DISPLAY_HUD_AMMUNITION_Y, pointerArea);
+				_renderString(STRING_ID_ENEMIES_AMOUNT, Renderer::FONT_SIZE_ID_SMALL, CONFIGURATION_DISPLAY_HUD_ENEMIES_X, CONFIGURATION_DISPLAY_HUD_ENEMIES_Y, pointerArea);
+				_renderString(STRING_ID_MORTAR_STATE, Renderer::FONT_SIZE_ID_SMALL, CONFIGURATION_DISPLAY_HUD_MORTAR_STATE_X, CONFIGURATION_DISPLAY_HUD_MORTAR_STATE_Y, pointerArea);
+				break;
+				
+			case WIDGET_ID_REMAINING_BONUS_TIME:
+				// Display bonus timer (if any)
+				pointerArea->w = 0;
+				pointerArea->h = 0;
+				if (pointerState->remainingBonusSeconds > 0)
+				{
+					Renderer::getTextSize(_strings[STRING_ID_REMAINING_BONUS_TIME].string, Renderer::FONT_SIZE_ID_BIG, &width, NULL);
+					pointerArea->x = (Renderer::displayWidth - width) / 2;
+					pointerArea->y = CONFIGURATION_DISPLAY_HUD_BONUS_TIMER_Y;
+					_renderString(STRING_ID_REMAINING_BONUS_TIME, Renderer::FONT_SIZE_ID_BIG, pointerArea->x, pointerArea->y, pointerArea);
+				}
+				break;
+				
+			default:
+				pointerCompassArrow = &_compassArrows[widgetId - WIDGET_ID_FIRST_COMPASS_ARROW];
+				if (pointerState->isCompassArrowLighted[widgetId - WIDGET_ID_FIRST_COMPASS_ARROW]) pointerTexture = pointerCompassArrow->pointerLightedTexture;
+				else pointerTexture = pointerCompassArrow->pointerTurnedOffTexture;
+				pointerTexture->render(pointerCompassArrow->x, pointerCompassArrow->y);
+				pointerArea->x = pointerCompassArrow->x;
+				pointerArea->y = pointerCompassArrow->y;
+				pointerArea->w = pointerTexture->getWidth();
+				pointerArea->h = pointerTexture->getHeight();
+				break;
+		}
+	}
+
+	/** Draw the widgets that changed to the HUD texture.
+	 * @param pointerState The values to display.
+	 */
+	static void _updateHeadUpDisplayTexture(const State *pointerState)
+	{
+		int i, j;
+		bool isWidgetDirty = false, isDirtyWidgetAdded;
+		
+		// Nothing is left in the texture if the renderer lost it
+		if (_isHeadUpDisplayTextureReset)
+		{
+			for (i = 0; i < WIDGET_IDS_COUNT; i++)
+			{
+				_widgets[i].isDirty = true;
+				_widgets[i].area.w = 0;
+				_widgets[i].area.h = 0;
+			}
+		}
+		
+		// Erasing a widget also erases the widgets it overlaps, so they must be drawn again too
+		do
+		{
+			isDirtyWidgetAdded = false;
+			for (i = 0; i < WIDGET_IDS_COUNT; i++)
+			{
+				if (!_widgets[i].isDirty) continue;
+				isWidgetDirty = true;
+				
+				for (j = 0; j < WIDGET_IDS_COUNT; j++)
+				{
+					if (!_widgets[j].isDirty && SDL_HasIntersection(&_widgets[i].area, &_widgets[j].area))
+					{
+						_widgets[j].isDirty = true;
+						isDirtyWidgetAdded = true;
+					}
+				}
+			}
+		} while (isDirtyWidgetAdded);
+		if (!isWidgetDirty) return;
+		
+		Renderer::setRenderTarget(_pointerHeadUpDisplayTexture);
+		
+		// Erase the previous widgets content with transparent pixels (the renderer does not blend when filling, so the pixels are replaced)
+		SDL_SetRenderDrawColor(Renderer::pointerRenderer, 0, 0, 0, 0);
+		if (_isHeadUpDisplayTextureReset)
+		{
+			SDL_RenderClear(Renderer::pointerRenderer);
+			_isHeadUpDisplayTextureReset = false;
+		}
+		else
+		{
+			for (i = 0; i < WIDGET_IDS_COUNT; i++)
+			{
+				if (_widgets[i].isDirty && !SDL_RectEmpty(&_widgets[i].area)) SDL_RenderFillRect(Renderer::pointerRenderer, &_widgets[i].area);
+			}
+		}
+		// Restore background color
+		SDL_SetRenderDrawColor(Renderer::pointerRenderer, 0, 0, 0, 255);
+		
+		// Draw the widgets that changed
+		for (i = 0; i < WIDGET_IDS_COUNT; i++)
+		{
+			if (!_widgets[i].isDirty) continue;
+			
+			_renderWidget(i, pointerState);
+			_widgets[i].isDirty = false;
+		}
+		
+		Renderer::setRenderTarget(NULL);
+		LOG_DEBUG("Refreshed HUD texture.");
+	}
+
+	/** Called by SDL for each event whatever the loop handling the events is, so the HUD texture is drawn again when the renderer lost the render targets content.
+	 * @param pointerEvent The event.
+	 * @return Always 0 (the return value is ignored by SDL).
+	 */
+	static int _headUpDisplayEventWatch(void *, SDL_Event *pointerEvent)
+	{
+		if (pointerEvent->type == SDL_RENDER_TARGETS_RESET) _isHeadUpDisplayTextureReset = true;
+		return 0;
+	}
+
+	int initialize()
+	{
+		// Cache background texture access to avoid searching for it at each frame
+		_pointerBackgroundTexture = getTextureFromId(TextureManager::TEXTURE_ID_HEAD_UP_DISPLAY_BACKGROUND);
+		
+		// Cache compass textures and position
+		// Down arrow
+		_compassArrows[1].pointerTurnedOffTexture = TextureManager::getTextureFromId(TextureManager::TEXTURE_ID_COMPASS_ARROW_DOWN_TURNED_OFF);
+		_compassArrows[1].pointerLightedTexture = TextureManager::getTextureFromId(TextureManager::TEXTURE_ID_COMPASS_ARROW_DOWN_LIGHTED);
+		_compassArrows[1].x = (Renderer::displayWidth - _compassArrows[1].pointerTurnedOffTexture->getWidth()) / 2;
+		_compassArrows[1].y = Renderer::displayHeight - _compassArrows[1].pointerTurnedOffTexture->getHeight() - 20; // Start from downer arrow as it has a fixed vertical position from the screen bottom
+		// Left arrow
+		_compassArrows[2].pointerTurnedOffTexture = TextureManager::getTextureFromId(TextureManager::TEXTURE_ID_COMPASS_ARROW_LEFT_TURNED_OFF);
+		_compassArrows[2].pointerLightedTexture = TextureManager::getTextureFromId(TextureManager::TEXTURE_ID_COMPASS_ARROW_LEFT_LIGHTED);
+		_compassArrows[2].x = ((Renderer::displayWidth - _compassArrows[2].pointerTurnedOffTexture->getWidth()) / 2) - 42;
+		_compassArrows[2].y = _compassArrows[1].y - _compassArrows[2].pointerTurnedOffTexture->getHeight() + 8; // Left arrow vertical position is computed from down arrow position
+		// Right arrow
+		_compassArrows[3].pointerTurnedOffTexture = TextureManager::getTextureFromId(TextureManager::TEXTURE_ID_COMPASS_ARROW_RIGHT_TURNED_OFF);
+		_compassArrows[3].pointerLightedTexture = TextureManager::getTextureFromId(TextureManager::TEXTURE_ID_COMPASS_ARROW_RIGHT_LIGHTED);
+		_compassArrows[3].x = ((Renderer::displayWidth - _compassArrows[2].pointerTurnedOffTexture->getWidth()) / 2) + 42;
+		_compassArrows[3].y = _compassArrows[2].y; // Right arrow vertical position is the same than left arrow
+		// Up arrow
+		_compassArrows[0].pointerTurnedOffTexture = TextureManager::getTextureFromId(TextureManager::TEXTURE_ID_COMPASS_ARROW_UP_TURNED_OFF);
+		_compassArrows[0].pointerLightedTexture = TextureManager::getTextureFromId(TextureManager::TEXTURE_ID_COMPASS_ARROW_UP_LIGHTED);
+		_compassArrows[0].x = (Renderer::displayWidth - _compassArrows[0].pointerTurnedOffTexture->getWidth()) / 2;
+		_compassArrows[0].y = _compassArrows[2].y - _compassArrows[0].pointerTurnedOffTexture->getHeight() + 8;
+		
+		// Nothing is displayed until the game logic provides the values
+		_state.enemiesAmount = 0;
+		_state.isLevelCleared = false;
+		_state.mortarState = MORTAR_STATE_READY;
+		_state.remainingBonusSeconds = 0;
+		for (int i = 0; i < COMPASS_ARROW_IDS_COUNT; i++) _state.isCompassArrowLighted[i] = false;
+		
+		// Use values that can't be reached in game, so all strings are formatted on game start
+		_renderedState.lifePointsAmount = -10;
+		_renderedState.ammunitionAmount = -10;
+		_renderedState.enemiesAmount = -10;
+		_renderedState.mortarState = MORTAR_STATE_INVALID;
+		_renderedState.remainingBonusSeconds = 0;
+		for (int i = 0; i < COMPASS_ARROW_IDS_COUNT; i++) _renderedState.isCompassArrowLighted[i] = false;
+		
+		// Draw the HUD to a texture when render targets are available
+		if (SDL_RenderTargetSupported(Renderer::pointerRenderer))
+		{
+			_pointerHeadUpDisplayTexture = SDL_CreateTexture(Renderer::pointerRenderer, SDL_PIXELFORMAT_ARGB8888, SDL_TEXTUREACCESS_TARGET, Renderer::displayWidth, Renderer::displayHeight);
+			if (_pointerHeadUpDisplayTexture == NULL)
+			{
+				LOG_ERROR("Failed to create the HUD texture (%s).", SDL_GetError());
+				return -1;
+			}
+			
+			// The widgets are blended when they are drawn to the texture, so the texture colors are already multiplied by their transparency
+			#if SDL_VERSION_ATLEAST(2, 0, 6)
+				if (SDL_SetTextureBlendMode(_pointerHeadUpDisplayTexture, SDL_ComposeCustomBlendMode(SDL_BLENDFACTOR_ONE, SDL_BLENDFACTOR_ONE_MINUS_SRC_ALPHA, SDL_BLENDOPERATION_ADD, SDL_BLENDFACTOR_ONE, SDL_BLENDFACTOR_ONE_MINUS_SRC_ALPHA, SDL_BLENDOPERATION_ADD)) != 0) SDL_SetTextureBlendMode(_pointerHeadUpDisplayTexture, SDL_BLENDMODE_BLEND);
+			#else
+				SDL_SetTextureBlendMode(_pointerHeadUpDisplayTexture, SDL_BLENDMODE_BLEND);
+			#endif
+			
+			// The texture content is undefined until it is fully drawn
+			_isHeadUpDisplayTextureReset = true;
+			SDL_AddEventWatch(_headUpDisplayEventWatch, NULL);
+		}
+		else LOG_INFORMATION("Render targets are not supported, the HUD will be fully rendered at each frame.");
+
+		return 0;
+	}
+
+	void uninitialize()
+	{
+		if (_pointerHeadUpDisplayTexture != NULL)
+		{
+			SDL_DelEventWatch(_headUpDisplayEventWatch, NULL);
+			SDL_DestroyTexture(_pointerHeadUpDisplayTexture);
+			_pointerHeadUpDisplayTexture = NULL;
+		}
+	}
+
+	void setEnemiesAmount(int amount)
+	{
+		_state.enemiesAmount = amount;
+		
+		// Display enemies in green if they are all dead and all enemy spawners are destroyed
+		_state.isLevelCleared = (amount == 0) && (LevelManager::enemySpawnersList.empty());
+	}
+
+	void setMortarState(MortarState state)
+	{
+		_state.mortarState = state;
+	}
+
+	void setRemainingBonusTime(int timeSeconds)
+	{
+		_state.remainingBonusSeconds = timeSeconds;
 	}
 
 	void setCompassArrowState(CompassArrowId id, bool isLighted)
 	{
 		assert(id < COMPASS_ARROW_IDS_COUNT);
-		_compassArrows[id].isLighted = isLighted;
+		_state.isCompassArrowLighted[id] = isLighted;
 	}
 
-	void render()
+	void getState(State *pointerState)
 	{
-		// Display background
-		Renderer::renderTexture(_pointerBackgroundTexture, CONFIGURATION_DISPLAY_HUD_BACKGROUND_TEXTURE_X, CONFIGURATION_DISPLAY_HUD_BACKGROUND_TEXTURE_Y);
-		
-		// Display HUD content
-		_displayPlayerLifePointsAmount();
-		_displayPlayerAmmunitionAmount();
-		Renderer::renderTexture(_pointerStringTextures[STRING_ID_ENEMIES_AMOUNT], CONFIGURATION_DISPLAY_HUD_ENEMIES_X, CONFIGURATION_DISPLAY_HUD_ENEMIES_Y);
-		Renderer::renderTexture(_pointerStringTextures[STRING_ID_MORTAR_STATE], CONFIGURATION_DISPLAY_HUD_MORTAR_STATE_X, CONFIGURATION_DISPLAY_HUD_MORTAR_STATE_Y);
+		*pointerState = _state;
+		pointerState->lifePointsAmount = pointerPlayer->getLifePointsAmount();
+		pointerState->maximumLifePointsAmount = pointerPlayer->getMaximumLifePointsAmount();
+		pointerState->ammunitionAmount = pointerPlayer->getAmmunitionAmount();
+	}
+
+	void render(const State *pointerState)
+	{
+		int i;
 		
-		// Display bonus timer (if any)
-		if (_isBonusRemainingSecondsStringDisplayed) Renderer::renderCenteredTexture(_pointerStringTextures[STRING_ID_REMAINING_BONUS_TIME], CONFIGURATION_DISPLAY_HUD_BONUS_TIMER_Y);
+		// Format the strings that changed
+		_updatePlayerLifePointsAmountString(pointerState);
+		_updatePlayerAmmunitionAmountString(pointerState);
+		_updateEnemiesAmountString(pointerState);
+		_updateMortarStateString(pointerState);
+		_updateRemainingBonusTimeString(pointerState);
+		_updateCompassArrows(pointerState);
 		
-		// Display compass
-		for (int i = 0; i < COMPASS_ARROW_IDS_COUNT; i++)
+		// Display all widgets at each frame when they can't be cached
+		if (_pointerHeadUpDisplayTexture == NULL)
 		{
-			if (_compassArrows[i].isLighted) _compassArrows[i].pointerLightedTexture->render(_compassArrows[i].x, _compassArrows[i].y);
-			else  _compassArrows[i].pointerTurnedOffTexture->render(_compassArrows[i].x, _compassArrows[i].y);
+			for (i = 0; i < WIDGET_IDS_COUNT; i++) _renderWidget(i, pointerState);
+			return;
 		}
+		
+		// Display the whole HUD at once
+		_updateHeadUpDisplayTexture(pointerState);
+		Renderer::renderBatchedTexture(_pointerHeadUpDisplayTexture, NULL, NULL);
 	}
 }
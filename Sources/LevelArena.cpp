@@ -0,0 +1,75 @@
+/** @file LevelArena.cpp
+ * See LevelArena.hpp for description.
+ * @author Adrien RICCIARDI
+ */
+#include <Configuration.hpp>
+#include <LevelArena.hpp>
+#include <Log.hpp>
+#include <new>
+
+namespace LevelArena
+{
+	/** All allocations are aligned on this value, which is suitable for any type. */
+	#define ALIGNMENT alignof(std::max_align_t)
+	
+	/** The header of a memory block taken from the heap when the arena is full. It is sized to keep the following memory aligned. */
+	typedef union HeapBlockHeader
+	{
+		union HeapBlockHeader *pointerNextHeader; //!< The next heap block, they are chained to be freed when the arena is reset.
+		std::max_align_t alignment; //!< Give the header the strictest alignment.
+	} HeapBlockHeader;
+	
+	/** The arena memory. */
+	alignas(ALIGNMENT) static unsigned char _memory[CONFIGURATION_LEVEL_ARENA_SIZE];
+	/** How many bytes of the arena memory are allocated. */
+	static size_t _usedBytesCount = 0;
+	
+	/** All blocks allocated from the heap since the last reset. */
+	static HeapBlockHeader *_pointerFirstHeapBlockHeader = NULL;
+	/** How many bytes were allocated from the heap since the last reset. */
+	static size_t _heapUsedBytesCount = 0;
+	
+	void *allocate(size_t size)
+	{
+		void *pointerMemory;
+		HeapBlockHeader *pointerHeader;
+		
+		// Keep the next allocation aligned
+		size = (size + ALIGNMENT - 1) & ~(ALIGNMENT - 1);
+		
+		// Take the memory from the arena if there is enough room
+		if (size <= CONFIGURATION_LEVEL_ARENA_SIZE - _usedBytesCount)
+		{
+			pointerMemory = &_memory[_usedBytesCount];
+			_usedBytesCount += size;
+			return pointerMemory;
+		}
+		
+		// The arena is full, use the heap
+		LOG_DEBUG("Level arena is full, allocating %u bytes from the heap.", static_cast<unsigned int>(size));
+		pointerHeader = static_cast<HeapBlockHeader *>(::operator new(sizeof(HeapBlockHeader) + size));
+		pointerHeader->pointerNextHeader = _pointerFirstHeapBlockHeader;
+		_pointerFirstHeapBlockHeader = pointerHeader;
+		_heapUsedBytesCount += size;
+		
+		return pointerHeader + 1;
+	}
+	
+	void reset()
+	{
+		HeapBlockHeader *pointerHeader;
+		
+		LOG_DEBUG("Releasing level arena (%u bytes used out of %d, %u bytes allocated from the heap).", static_cast<unsigned int>(_usedBytesCount), CONFIGURATION_LEVEL_ARENA_SIZE, static_cast<unsigned int>(_heapUsedBytesCount));
+		
+		// Free the memory taken from the heap, there is nothing to free most of the time
+		while (_pointerFirstHeapBlockHeader != NULL)
+		{
+			pointerHeader = _pointerFirstHeapBlockHeader;
+			_pointerFirstHeapBlockHeader = pointerHeader->pointerNextHeader;
+			::operator delete(pointerHeader);
+		}
+		_heapUsedBytesCount = 0;
+		
+		_usedBytesCount = 0;
+	}
+}
@@ -5,16 +5,20 @@
 #include <cassert>
 #include <cerrno>
 #include <Configuration.hpp>
+#include <cstdint>
 #include <cstdio>
 #include <cstring>
 #include <FileManager.hpp>
+#include <LevelFile.hpp>
 #include <LevelManager.hpp>
 #include <list>
 #include <Log.hpp>
 #include <PlayerFightingEntity.hpp>
 #include <Renderer.hpp>
+#include <SDL2/SDL.h>
 #include <Texture.hpp>
 #include <TextureManager.hpp>
+#include <vector>
 
 namespace LevelManager
 {
@@ -25,24 +29,56 @@ namespace LevelManager
 	*/
 	#define COMPUTE_BLOCK_INDEX(x, y) (((y) * _levelWidthBlocks) + (x))
 
-	/** A block. */
+	/** All block content bits that are displayed by the scene, the scene chunk containing the block must be rendered again when one of them changes. */
+	#define SCENE_VISIBLE_BLOCK_CONTENT_MASK (BLOCK_CONTENT_MEDIPACK | BLOCK_CONTENT_GOLDEN_MEDIPACK | BLOCK_CONTENT_AMMUNITION | BLOCK_CONTENT_MACHINE_GUN_BONUS | BLOCK_CONTENT_BULLETPROOF_VEST_BONUS)
+	/** A scene chunk size in pixels. */
+	#define SCENE_CHUNK_SIZE_PIXELS (CONFIGURATION_LEVEL_SCENE_CHUNK_SIZE * CONFIGURATION_LEVEL_BLOCK_SIZE)
+	/** All block content bits making a block an obstacle : the enemies can't walk on it nor shoot through it. The enemies are not included, because they move all the time. */
+	#define OBSTACLE_BLOCK_CONTENT_MASK (BLOCK_CONTENT_WALL | BLOCK_CONTENT_ENEMY_SPAWNER)
+	/** How many 64-bit words are needed to store one bit per block of a level row. */
+	#define OBSTACLE_ROW_BITMASK_WORDS_COUNT ((CONFIGURATION_LEVEL_MAXIMUM_WIDTH + 63) / 64)
+	/** How many 64-bit words are needed to store one bit per block of a level column. */
+	#define OBSTACLE_COLUMN_BITMASK_WORDS_COUNT ((CONFIGURATION_LEVEL_MAXIMUM_HEIGHT + 63) / 64)
+	/** The distance of the blocks the player can't be reached from. */
+	#define PLAYER_PATH_UNREACHABLE_DISTANCE 0xFFFF
+	/** How many scene chunks a level can be made of. */
+	#define SCENE_CHUNKS_MAXIMUM_COUNT (((CONFIGURATION_LEVEL_MAXIMUM_WIDTH + CONFIGURATION_LEVEL_SCENE_CHUNK_SIZE - 1) / CONFIGURATION_LEVEL_SCENE_CHUNK_SIZE) * ((CONFIGURATION_LEVEL_MAXIMUM_HEIGHT + CONFIGURATION_LEVEL_SCENE_CHUNK_SIZE - 1) / CONFIGURATION_LEVEL_SCENE_CHUNK_SIZE))
+
+	/** A level decoded from the level files. Entities can be created by the game thread only, so the player and the enemy spawners locations are stored to be spawned when the level starts. */
 	typedef struct
 	{
-		Texture *pointerTexture; //!< The texture used to render the block.
-		int content; //!< A bit field telling what the block contains (objects or scene details). Use values from BlockContent to handle the bit field.
-	} Block;
+		int levelNumber; //!< The decoded level number, or -1 if no valid level is stored.
+		int widthBlocks; //!< The level width in blocks.
+		int heightBlocks; //!< The level height in blocks.
+		int playerX; //!< The player starting block X coordinate.
+		int playerY; //!< The player starting block Y coordinate.
+		std::vector<LevelFile::EnemySpawner> enemySpawners; //!< All enemy spawners locations, in the order they must be spawned.
+		std::vector<uint16_t> blocksContent; //!< A bit field per block telling what the block contains (objects or scene details). Use values from BlockContent to handle the bit field (all values must fit in 16 bits).
+		std::vector<uint8_t> blocksTextureIds; //!< The scene texture ID used to render each block.
+	} LevelData;
 
-	/** All available spawnable objects. */
+	/** All obstacle distance fields, one for each block content combination the entities collide with. */
 	typedef enum
 	{
-		OBJECT_ID_PLAYER,
-		OBJECT_ID_MEDIPACK,
-		OBJECT_ID_AMMUNITION,
-		OBJECT_ID_ENEMY_SPAWNER,
-		OBJECT_ID_LEVEL_EXIT,
-		OBJECT_ID_GOLDEN_MEDIPACK,
-		OBJECT_IDS_COUNT
-	} ObjectId;
+		OBSTACLE_DISTANCE_FIELD_ID_WALLS, //!< The player bullets collide with the walls only.
+		OBSTACLE_DISTANCE_FIELD_ID_WALLS_AND_ENEMY_SPAWNERS, //!< The fighting entities and the enemies bullets collide with the walls and the enemy spawners.
+		OBSTACLE_DISTANCE_FIELD_IDS_COUNT
+	} ObstacleDistanceFieldId;
+
+	/** The shortest way to the player from a block. */
+	typedef struct
+	{
+		uint16_t distance; //!< How many blocks separate this block from the player one.
+		uint8_t direction; //!< The direction to go to reach the next block of the way (a MovingEntity::Direction value).
+	} PlayerPathBlock;
+
+	/** A texture containing a pre-rendered part of the scene (a square of CONFIGURATION_LEVEL_SCENE_CHUNK_SIZE blocks side). */
+	typedef struct
+	{
+		SDL_Texture *pointerTexture; //!< The render target texture, it is created the first time the cache entry is used.
+		int chunkIndex; //!< The level chunk rendered in the texture, or -1 if the texture content is not valid.
+		unsigned int lastDisplayedFrame; //!< The last frame the chunk was displayed at, the least recently displayed chunk is replaced when a new chunk is needed.
+	} SceneChunk;
 
 	/** The level width in blocks. */
 	static int _levelWidthBlocks;
@@ -54,9 +90,72 @@ namespace LevelManager
 	/** The display height in blocks (rounded to the upper to make sure all the display is filled). */
 	static int _displayHeightBlocks;
 
-	/** Contain all level blocks. */
-	static Block _levelBlocks[CONFIGURATION_LEVEL_MAXIMUM_WIDTH * CONFIGURATION_LEVEL_MAXIMUM_HEIGHT];
+	/** Two levels are stored : the one being played and the next one, decoded in the background. */
+	static LevelData _levelsData[2];
+	/** The level being played. */
+	static LevelData *_pointerCurrentLevelData = &_levelsData[0];
+	/** The level decoded in the background. It is swapped with the current level when it starts. */
+	static LevelData *_pointerPreloadedLevelData = &_levelsData[1];
+	/** The content of all blocks of the level being played. Collision checks only read this plane, so it is kept as small as possible to stay in the processor cache. */
+	static uint16_t *_levelBlocksContent;
+	/** The texture ID of all blocks of the level being played. */
+	static uint8_t *_levelBlocksTextureIds;
+
+	/** A bit per block of each level row, set when the block is an obstacle, so a whole row segment can be checked with a few operations. */
+	static uint64_t _obstacleRowsBitmasks[CONFIGURATION_LEVEL_MAXIMUM_HEIGHT][OBSTACLE_ROW_BITMASK_WORDS_COUNT];
+	/** A bit per block of each level column, set when the block is an obstacle. */
+	static uint64_t _obstacleColumnsBitmasks[CONFIGURATION_LEVEL_MAXIMUM_WIDTH][OBSTACLE_COLUMN_BITMASK_WORDS_COUNT];
+
+	/** The block content bits each obstacle distance field considers as obstacles. */
+	static const int _obstacleDistanceFieldsBlockContents[OBSTACLE_DISTANCE_FIELD_IDS_COUNT] =
+	{
+		BLOCK_CONTENT_WALL,
+		BLOCK_CONTENT_WALL | BLOCK_CONTENT_ENEMY_SPAWNER
+	};
+	/** For each level block and each direction, how many blocks can be crossed before reaching an obstacle (up to 255 blocks). A block distances are stored contiguously, in the MovingEntity::Direction order. */
+	static std::vector<uint8_t> _obstacleDistanceFields[OBSTACLE_DISTANCE_FIELD_IDS_COUNT];
+
+	/** The shortest way to the player from every level block, all enemies share it. */
+	static std::vector<PlayerPathBlock> _playerPathBlocks;
+	/** The blocks the breadth-first search computing the player paths still has to visit (the vector is kept to reuse its memory). */
+	static std::vector<int> _playerPathBlocksQueue;
+	/** The player block index the player paths have been computed from, or -1 if the paths must be computed again. */
+	static int _playerPathsOriginBlockIndex = -1;
+
+	/** Tell whether a level has been loaded since the last scene update. */
+	static bool _isLevelChanged = false;
+	/** The blocks which displayed content changed since the last scene update. */
+	static std::vector<SceneBlockChange> _sceneBlockChanges;
+
+	/** The displayed scene width in blocks. The displayed scene is a copy of the level owned by the rendering thread, so the game logic can modify the level while the scene is displayed. */
+	static int _sceneWidthBlocks = 0;
+	/** The displayed scene height in blocks. */
+	static int _sceneHeightBlocks = 0;
+	/** The texture ID of all displayed scene blocks. */
+	static std::vector<uint8_t> _sceneBlocksTextureIds;
+	/** The content of all displayed scene blocks. */
+	static std::vector<uint16_t> _sceneBlocksContent;
+
+	/** The level width in scene chunks. */
+	static int _levelWidthSceneChunks;
+	/** The level height in scene chunks. */
+	static int _levelHeightSceneChunks;
+	/** The scene chunks cache, or NULL if the renderer does not support render targets (each block is directly rendered in this case). */
+	static SceneChunk *_pointerSceneChunks = NULL;
+	/** How many chunks the cache contains, enough to cover the display whatever the camera position is, plus one more row and one more column to avoid rendering the same chunks again when the camera goes back and forth. */
+	static int _sceneChunksCount;
+	/** Tell which cache entry contains each level chunk (-1 if the chunk is not in the cache). */
+	static int _sceneChunksCacheIndexes[SCENE_CHUNKS_MAXIMUM_COUNT];
+	/** Incremented each time the scene is rendered. */
+	static unsigned int _sceneFramesCounter = 0;
+
+	/** The thread decoding the next level while the current one is played (NULL when no level is being preloaded). */
+	static SDL_Thread *_pointerPreloadingThread = NULL;
+	/** The level the preloading thread is decoding. */
+	static int _preloadingLevelNumber;
 
+	/** Cache all scene textures, so a block texture is directly found from its ID. */
+	static Texture *_pointerSceneTextures[LEVEL_FILE_SCENE_TEXTURES_COUNT];
 	/** Cache medipack texture. */
 	static Texture *_pointerMedipackTexture;
 	/** Cache golden medipack texture. */
@@ -69,10 +168,46 @@ namespace LevelManager
 	static Texture *_pointerBulletproofVestBonusTexture;
 
 	// Public variable, documentation is in the header file
-	std::list<EnemySpawnerStaticEntity *> enemySpawnersList;
+	std::list<EnemySpawnerStaticEntity *, LevelArena::Allocator<EnemySpawnerStaticEntity *> > enemySpawnersList;
+
+	/** Wait for the preloading thread to finish decoding the next level. */
+	static void _waitForPreloadingThread()
+	{
+		if (_pointerPreloadingThread == NULL) return;
+		
+		SDL_WaitThread(_pointerPreloadingThread, NULL);
+		_pointerPreloadingThread = NULL;
+	}
+
+	/** Render all scene chunks again the next time they are displayed. */
+	static void _invalidateSceneCache()
+	{
+		int i;
+		
+		if (_pointerSceneChunks == NULL) return;
+		
+		for (i = 0; i < _sceneChunksCount; i++)
+		{
+			_pointerSceneChunks[i].chunkIndex = -1;
+			_pointerSceneChunks[i].lastDisplayedFrame = 0;
+		}
+		for (i = 0; i < SCENE_CHUNKS_MAXIMUM_COUNT; i++) _sceneChunksCacheIndexes[i] = -1;
+	}
+
+	/** Called by SDL for each event whatever the loop handling the events is, so the scene chunks are rendered again when the renderer lost the render targets content.
+	 * @param pointerEvent The event.
+	 * @return Always 0 (the return value is ignored by SDL).
+	 */
+	static int _sceneChunksEventWatch(void *, SDL_Event *pointerEvent)
+	{
+		if (pointerEvent->type == SDL_RENDER_TARGETS_RESET) _invalidateSceneCache();
+		return 0;
+	}
 
 	int initialize()
 	{
+		int i;
+		
 		// Compute the amount of blocks that can be simultaneously displayed on the current display
 		_displayWidthBlocks = Renderer::displayWidth / CONFIGURATION_LEVEL_BLOCK_SIZE;
 		if (Renderer::displayWidth % CONFIGURATION_LEVEL_BLOCK_SIZE != 0) _displayWidthBlocks++;
@@ -86,24 +221,145 @@ namespace LevelManager
 		_pointerAmmunitionTexture = TextureManager::getTextureFromId(TextureManager::TEXTURE_ID_AMMUNITION);
 		_pointerMachineGunBonusTexture = TextureManager::getTextureFromId(TextureManager::TEXTURE_ID_MACHINE_GUN);
 		_pointerBulletproofVestBonusTexture = TextureManager::getTextureFromId(TextureManager::TEXTURE_ID_BULLETPROOF_VEST);
+		for (i = 0; i < LEVEL_FILE_SCENE_TEXTURES_COUNT; i++) _pointerSceneTextures[i] = TextureManager::getTextureFromId(static_cast<TextureManager::TextureId>(i));
+		
+		// No level has been decoded yet
+		_levelsData[0].levelNumber = -1;
+		_levelsData[1].levelNumber = -1;
+		
+		// Pre-render the scene to render targets when they are available (chunk textures are created when they are needed)
+		if (SDL_RenderTargetSupported(Renderer::pointerRenderer))
+		{
+			_sceneChunksCount = ((_displayWidthBlocks / CONFIGURATION_LEVEL_SCENE_CHUNK_SIZE) + 3) * ((_displayHeightBlocks / CONFIGURATION_LEVEL_SCENE_CHUNK_SIZE) + 3);
+			_pointerSceneChunks = new SceneChunk[_sceneChunksCount];
+			for (i = 0; i < _sceneChunksCount; i++) _pointerSceneChunks[i].pointerTexture = NULL;
+			_invalidateSceneCache();
+			SDL_AddEventWatch(_sceneChunksEventWatch, NULL);
+			LOG_DEBUG("Scene chunks cache contains %d chunks.", _sceneChunksCount);
+		}
+		else LOG_INFORMATION("Render targets are not supported, the scene blocks will be rendered one by one.");
 
 		return 0;
 	}
 
 	void uninitialize()
 	{
-		// TODO if needed
+		int i;
+		
+		// Do not let the thread run while the program is exiting
+		_waitForPreloadingThread();
+		
+		// Free the scene chunks cache
+		if (_pointerSceneChunks != NULL)
+		{
+			SDL_DelEventWatch(_sceneChunksEventWatch, NULL);
+			for (i = 0; i < _sceneChunksCount; i++)
+			{
+				if (_pointerSceneChunks[i].pointerTexture != NULL) SDL_DestroyTexture(_pointerSceneChunks[i].pointerTexture);
+			}
+			delete[] _pointerSceneChunks;
+			_pointerSceneChunks = NULL;
+		}
+	}
+
+	/** Append a block to a decoded level, setting the block texture and the corresponding collision.
+	 * @param pointerLevelData The level being decoded.
+	 * @param textureId The block texture ID.
+	 * @return -1 if the texture is not a scene texture,
+	 * @return 0 on success.
+	 */
+	static inline int _addBlockScene(LevelData *pointerLevelData, int textureId)
+	{
+		// Set block collision
+		if ((textureId >= 0) && (textureId < TextureManager::TEXTURE_ID_SCENE_WALL_0)) pointerLevelData->blocksContent.push_back(0); // This is a floor block, it does not collide with nothing
+		else if ((textureId >= TextureManager::TEXTURE_ID_SCENE_WALL_0) && (textureId < TextureManager::TEXTURE_ID_MEDIPACK)) pointerLevelData->blocksContent.push_back(BLOCK_CONTENT_WALL); // This is a wall block
+		else return -1;
+		
+		// Set block texture
+		pointerLevelData->blocksTextureIds.push_back(textureId);
+		return 0;
 	}
 
-	int loadLevel(int levelNumber)
+	/** Add an object to a decoded level block. The block scene must have been set before.
+	 * @param pointerLevelData The level being decoded.
+	 * @param x X coordinate in blocks.
+	 * @param y Y coordinate in blocks.
+	 * @param objectId The object to add (-1 means that there is no object on the block).
+	 * @param pointerIsPlayerFound Tell whether the player has already been found, it is set to true when the player is found.
+	 * @return -1 if the object can't be added,
+	 * @return 0 on success.
+	 */
+	static int _decodeObject(LevelData *pointerLevelData, int x, int y, int objectId, bool *pointerIsPlayerFound)
+	{
+		uint16_t *pointerBlockContent = &pointerLevelData->blocksContent[(y * pointerLevelData->widthBlocks) + x];
+		LevelFile::EnemySpawner enemySpawner;
+		
+		switch (objectId)
+		{
+			// Ignore unset blocks
+			case -1:
+				break;
+			
+			case LevelFile::OBJECT_ID_PLAYER:
+				// Make sure the player is unique
+				if (*pointerIsPlayerFound)
+				{
+					LOG_ERROR("More than one player are present on the map. Make sure to have only one player.");
+					return -1;
+				}
+				pointerLevelData->playerX = x;
+				pointerLevelData->playerY = y;
+				*pointerIsPlayerFound = true;
+				break;
+				
+			case LevelFile::OBJECT_ID_MEDIPACK:
+				*pointerBlockContent |= BLOCK_CONTENT_MEDIPACK;
+				LOG_DEBUG("Spawned medipack on block (%d, %d).", x, y);
+				break;
+				
+			case LevelFile::OBJECT_ID_GOLDEN_MEDIPACK:
+				*pointerBlockContent |= BLOCK_CONTENT_GOLDEN_MEDIPACK;
+				LOG_DEBUG("Spawned golden medipack on block (%d, %d).", x, y);
+				break;
+				
+			case LevelFile::OBJECT_ID_AMMUNITION:
+				*pointerBlockContent |= BLOCK_CONTENT_AMMUNITION;
+				LOG_DEBUG("Spawned ammunition on block (%d, %d).", x, y);
+				break;
+				
+			case LevelFile::OBJECT_ID_ENEMY_SPAWNER:
+				enemySpawner.x = x;
+				enemySpawner.y = y;
+				pointerLevelData->enemySpawners.push_back(enemySpawner);
+				*pointerBlockContent |= BLOCK_CONTENT_ENEMY_SPAWNER;
+				break;
+				
+			case LevelFile::OBJECT_ID_LEVEL_EXIT:
+				*pointerBlockContent |= BLOCK_CONTENT_LEVEL_EXIT;
+				LOG_DEBUG("Spawned level exit on block (%d, %d).", x, y);
+				break;
+				
+			default:
+				LOG_INFORMATION("Unhandled object (object ID : %d) at block (%d, %d).", objectId, x, y);
+				break;
+		}
+		
+		return 0;
+	}
+
+	/** Decode a level from two Comma Separated Value files (x_Scene.csv and x_Objects.csv, where x is the level number).
+	 * @param levelNumber The level number (starting from 0).
+	 * @param pointerLevelData On output, contain the decoded level.
+	 * @return -1 if an error occurred,
+	 * @return 0 if the level was successfully decoded.
+	 */
+	static int _decodeTextLevel(int levelNumber, LevelData *pointerLevelData)
 	{
 		FILE *pointerFile;
-		int x, y, character, i, objectId, isPlayerSpawned = 0;
-		TextureManager::TextureId textureId;
+		int x, y, character, textureId, objectId;
+		bool isPlayerFound = false;
 		char stringFileName[256];
 		
-		LOG_DEBUG("Loading level %d...", levelNumber);
-		
 		// Try to open the scene file
 		snprintf(stringFileName, sizeof(stringFileName), FileManager::getFilePath("Levels/%d_Scene.csv"), levelNumber);
 		pointerFile = fopen(stringFileName, "r");
@@ -113,46 +369,40 @@ namespace LevelManager
 			return -1;
 		}
 		
-		_levelWidthBlocks = 0;
-		_levelHeightBlocks = 0;
+		pointerLevelData->widthBlocks = 0;
+		pointerLevelData->heightBlocks = 0;
+		pointerLevelData->blocksContent.clear();
+		pointerLevelData->blocksTextureIds.clear();
 		
 		// Parse the whole file considering it does not contain errors
-		i = 0;
 		for (y = 0; y < CONFIGURATION_LEVEL_MAXIMUM_HEIGHT; y++)
 		{
 			for (x = 0; x < CONFIGURATION_LEVEL_MAXIMUM_WIDTH; x++)
 			{
 				// Read a block index
-				if (fscanf(pointerFile, "%d", (int *) &textureId) != 1) goto Scene_Loading_End;
-				
-				// Set block texture
-				_levelBlocks[i].pointerTexture = TextureManager::getTextureFromId(textureId);
+				if (fscanf(pointerFile, "%d", &textureId) != 1) goto Scene_Loading_End;
 				
-				// Set block collision
-				if (textureId < TextureManager::TEXTURE_ID_SCENE_WALL_0) _levelBlocks[i].content = 0; // This is a floor block, it does not collide with nothing
-				else if (textureId < TextureManager::TEXTURE_ID_MEDIPACK) _levelBlocks[i].content = BLOCK_CONTENT_WALL; // This is a wall block
-				else
+				// Set block texture and collision
+				if (_addBlockScene(pointerLevelData, textureId) != 0)
 				{
-					LOG_ERROR("Block (%d, %d) ID is bad : %d.", x, y, (int) textureId);
+					LOG_ERROR("Block (%d, %d) ID is bad : %d.", x, y, textureId);
 					fclose(pointerFile);
 					return -1;
 				}
-				i++;
 				
 				// Discard the following comma
 				character = fgetc(pointerFile);
 				// Load next row if a newline character is found
 				if (character == '\n')
 				{
-					_levelWidthBlocks = x + 1; // Set level width in the same time
+					pointerLevelData->widthBlocks = x + 1; // Set level width in the same time
 					break;
 				}
 			}
 		}
 		
 	Scene_Loading_End:
-		_levelHeightBlocks = y;
-		LOG_DEBUG("Level size : %dx%d blocks.", _levelWidthBlocks, _levelHeightBlocks);
+		pointerLevelData->heightBlocks = y;
 		fclose(pointerFile);
 		
 		// Try to open the objects file
@@ -164,10 +414,10 @@ namespace LevelManager
 			return -1;
 		}
 		
-		// Spawn objects
-		for (y = 0; y < _levelHeightBlocks; y++)
+		// Decode objects
+		for (y = 0; y < pointerLevelData->heightBlocks; y++)
 		{
-			for (x = 0; x < _levelWidthBlocks; x++)
+			for (x = 0; x < pointerLevelData->widthBlocks; x++)
 			{
 				// Read an object index
 				if (fscanf(pointerFile, "%d", &objectId) != 1)
@@ -176,65 +426,8 @@ namespace LevelManager
 					goto Objects_Loading_Error;
 				}
 				
-				// Spawn the requested object
-				switch (objectId)
-				{
-					// Ignore unset blocks
-					case -1:
-						break;
-					
-					case OBJECT_ID_PLAYER:
-						// Make sure the player is unique
-						if (isPlayerSpawned)
-						{
-							LOG_ERROR("More than one player are present on the map. Make sure to have only one player.");
-							goto Objects_Loading_Error;
-						}
-						else
-						{
-							// Get player size from its texture
-							Texture *pointerTexture = TextureManager::getTextureFromId(TextureManager::TEXTURE_ID_PLAYER_FACING_UP);
-							int playerWidth = pointerTexture->getWidth();
-							int playerHeight = pointerTexture->getHeight();
-							
-							// Put the player at the block center
-							pointerPlayer->setX((x * CONFIGURATION_LEVEL_BLOCK_SIZE) + ((CONFIGURATION_LEVEL_BLOCK_SIZE - playerWidth) / 2));
-							pointerPlayer->setY((y * CONFIGURATION_LEVEL_BLOCK_SIZE) + ((CONFIGURATION_LEVEL_BLOCK_SIZE - playerHeight) / 2));
-							isPlayerSpawned = 1;
-							LOG_DEBUG("Spawned player on block (%d, %d).", x, y);
-						}
-						break;
-						
-					case OBJECT_ID_MEDIPACK:
-						_levelBlocks[COMPUTE_BLOCK_INDEX(x, y)].content |= BLOCK_CONTENT_MEDIPACK;
-						LOG_DEBUG("Spawned medipack on block (%d, %d).", x, y);
-						break;
-						
-					case OBJECT_ID_GOLDEN_MEDIPACK:
-						_levelBlocks[COMPUTE_BLOCK_INDEX(x, y)].content |= BLOCK_CONTENT_GOLDEN_MEDIPACK;
-						LOG_DEBUG("Spawned golden medipack on block (%d, %d).", x, y);
-						break;
-						
-					case OBJECT_ID_AMMUNITION:
-						_levelBlocks[COMPUTE_BLOCK_INDEX(x, y)].content |= BLOCK_CONTENT_AMMUNITION;
-						LOG_DEBUG("Spawned ammunition on block (%d, %d).", x, y);
-						break;
-						
-					case OBJECT_ID_ENEMY_SPAWNER:
-						enemySpawnersList.push_front(new EnemySpawnerStaticEntity(x * CONFIGURATION_LEVEL_BLOCK_SIZE, y * CONFIGURATION_LEVEL_BLOCK_SIZE));
-						_levelBlocks[COMPUTE_BLOCK_INDEX(x, y)].content |= BLOCK_CONTENT_ENEMY_SPAWNER;
-						LOG_DEBUG("Spawned enemy spawner on block (%d, %d).", x, y);
-						break;
-						
-					case OBJECT_ID_LEVEL_EXIT:
-						_levelBlocks[COMPUTE_BLOCK_INDEX(x, y)].content |= BLOCK_CONTENT_LEVEL_EXIT;
-						LOG_DEBUG("Spawned level exit on block (%d, %d).", x, y);
-						break;
-						
-					default:
-						LOG_INFORMATION("Unhandled object (object ID : %d) at block (%d, %d).", objectId, x, y);
-						break;
-				}
+				// Add the requested object
+				if (_decodeObject(pointerLevelData, x, y, objectId, &isPlayerFound) != 0) goto Objects_Loading_Error;
 				
 				// Discard the following comma
 				character = fgetc(pointerFile);
@@ -242,15 +435,13 @@ namespace LevelManager
 		}
 		
 		// Make sure there is a player
-		if (!isPlayerSpawned)
+		if (!isPlayerFound)
 		{
 			LOG_ERROR("Map does not contain any player.");
 			goto Objects_Loading_Error;
 		}
 		
 		fclose(pointerFile);
-		
-		LOG_INFORMATION("Level %d successfully loaded.", levelNumber);
 		return 0;
 		
 	Objects_Loading_Error:
@@ -258,7 +449,427 @@ namespace LevelManager
 		return -1;
 	}
 
-	void renderScene(int topLeftX, int topLeftY)
+	/** Decode a level generated by the level compiler (x_Level.bin, where x is the level number). The file is mapped to memory and, as the level compiler already validated the level, the level is built directly from the file content. Only the file layout is checked, so an outdated or truncated file can't make the game crash.
+	 * @param levelNumber The level number (starting from 0).
+	 * @param pointerLevelData On output, contain the decoded level.
+	 * @return 0 if the level was successfully decoded,
+	 * @return 1 if there is no valid compiled level file, the level text files can be used instead.
+	 */
+	static int _decodeCompiledLevel(int levelNumber, LevelData *pointerLevelData)
+	{
+		char stringFileName[256];
+		const unsigned char *pointerFileContent;
+		size_t fileSize;
+		const LevelFile::Header *pointerHeader;
+		const int16_t *pointerScenePlane;
+		const uint8_t *pointerWallsBitmask;
+		const int8_t *pointerObjectsPlane;
+		const LevelFile::EnemySpawner *pointerEnemySpawners;
+		int x, y, i, blocksCount, returnValue = 1;
+		bool isPlayerFound = true; // The player is not stored in the objects plane
+		
+		// The compiled level scene texture IDs are directly used as game texture IDs
+		static_assert(TextureManager::TEXTURE_ID_SCENE_WALL_0 == LEVEL_FILE_SCENE_FLOOR_TEXTURES_COUNT, "The level file floor textures count does not match the game textures.");
+		static_assert(TextureManager::TEXTURE_ID_MEDIPACK == LEVEL_FILE_SCENE_TEXTURES_COUNT, "The level file scene textures count does not match the game textures.");
+		
+		// Try to map the file
+		snprintf(stringFileName, sizeof(stringFileName), FileManager::getFilePath("Levels/%d_Level.bin"), levelNumber);
+		pointerFileContent = static_cast<const unsigned char *>(FileManager::mapFile(stringFileName, &fileSize));
+		if (pointerFileContent == NULL) return 1;
+		
+		// Make sure the file is a level file using the right format version
+		pointerHeader = reinterpret_cast<const LevelFile::Header *>(pointerFileContent);
+		if ((fileSize < sizeof(LevelFile::Header)) || (pointerHeader->magicNumber != LEVEL_FILE_MAGIC_NUMBER))
+		{
+			LOG_ERROR("'%s' is not a level file.", stringFileName);
+			goto Exit;
+		}
+		if (pointerHeader->version != LEVEL_FILE_VERSION)
+		{
+			LOG_INFORMATION("'%s' format version is %u whereas version %d is expected, levels need to be compiled again.", stringFileName, pointerHeader->version, LEVEL_FILE_VERSION);
+			goto Exit;
+		}
+		if (pointerHeader->fileSize != fileSize)
+		{
+			LOG_ERROR("'%s' is truncated (%u bytes instead of %u).", stringFileName, static_cast<unsigned int>(fileSize), pointerHeader->fileSize);
+			goto Exit;
+		}
+		
+		// Make sure the level fits in the blocks array
+		if ((pointerHeader->widthBlocks == 0) || (pointerHeader->widthBlocks > CONFIGURATION_LEVEL_MAXIMUM_WIDTH) || (pointerHeader->heightBlocks == 0) || (pointerHeader->heightBlocks > CONFIGURATION_LEVEL_MAXIMUM_HEIGHT) || (pointerHeader->playerX >= pointerHeader->widthBlocks) || (pointerHeader->playerY >= pointerHeader->heightBlocks))
+		{
+			LOG_ERROR("'%s' level size is bad : %ux%u blocks.", stringFileName, pointerHeader->widthBlocks, pointerHeader->heightBlocks);
+			goto Exit;
+		}
+		blocksCount = pointerHeader->widthBlocks * pointerHeader->heightBlocks;
+		
+		// Make sure all parts are aligned and located inside the file (offsets are checked before sizes to avoid overflowing)
+		if ((pointerHeader->scenePlaneOffset % sizeof(int16_t) != 0) || (pointerHeader->scenePlaneOffset > fileSize) || ((fileSize - pointerHeader->scenePlaneOffset) / sizeof(int16_t) < static_cast<size_t>(blocksCount))
+			|| (pointerHeader->wallsBitmaskOffset > fileSize) || (fileSize - pointerHeader->wallsBitmaskOffset < static_cast<size_t>((blocksCount + 7) / 8))
+			|| (pointerHeader->objectsPlaneOffset > fileSize) || (fileSize - pointerHeader->objectsPlaneOffset < static_cast<size_t>(blocksCount))
+			|| (pointerHeader->enemySpawnersOffset % sizeof(uint16_t) != 0) || (pointerHeader->enemySpawnersOffset > fileSize) || ((fileSize - pointerHeader->enemySpawnersOffset) / sizeof(LevelFile::EnemySpawner) < pointerHeader->enemySpawnersCount))
+		{
+			LOG_ERROR("'%s' content is not located inside the file.", stringFileName);
+			goto Exit;
+		}
+		pointerScenePlane = reinterpret_cast<const int16_t *>(pointerFileContent + pointerHeader->scenePlaneOffset);
+		pointerWallsBitmask = pointerFileContent + pointerHeader->wallsBitmaskOffset;
+		pointerObjectsPlane = reinterpret_cast<const int8_t *>(pointerFileContent + pointerHeader->objectsPlaneOffset);
+		pointerEnemySpawners = reinterpret_cast<const LevelFile::EnemySpawner *>(pointerFileContent + pointerHeader->enemySpawnersOffset);
+		
+		// Build the scene, the walls are already known so there is no need to look at the texture IDs
+		pointerLevelData->widthBlocks = pointerHeader->widthBlocks;
+		pointerLevelData->heightBlocks = pointerHeader->heightBlocks;
+		pointerLevelData->blocksContent.resize(blocksCount);
+		pointerLevelData->blocksTextureIds.resize(blocksCount);
+		for (i = 0; i < blocksCount; i++)
+		{
+			assert((pointerScenePlane[i] >= 0) && (pointerScenePlane[i] < LEVEL_FILE_SCENE_TEXTURES_COUNT));
+			pointerLevelData->blocksTextureIds[i] = static_cast<uint8_t>(pointerScenePlane[i]);
+			if ((pointerWallsBitmask[i >> 3] >> (i & 7)) & 1) pointerLevelData->blocksContent[i] = BLOCK_CONTENT_WALL;
+			else pointerLevelData->blocksContent[i] = 0;
+		}
+		
+		// Add objects, the player and the enemy spawners are not stored in the objects plane so nothing can fail
+		pointerLevelData->playerX = pointerHeader->playerX;
+		pointerLevelData->playerY = pointerHeader->playerY;
+		i = 0;
+		for (y = 0; y < pointerLevelData->heightBlocks; y++)
+		{
+			for (x = 0; x < pointerLevelData->widthBlocks; x++)
+			{
+				assert((pointerObjectsPlane[i] != LevelFile::OBJECT_ID_PLAYER) && (pointerObjectsPlane[i] != LevelFile::OBJECT_ID_ENEMY_SPAWNER));
+				if (pointerObjectsPlane[i] != -1) _decodeObject(pointerLevelData, x, y, pointerObjectsPlane[i], &isPlayerFound);
+				i++;
+			}
+		}
+		for (i = 0; i < static_cast<int>(pointerHeader->enemySpawnersCount); i++)
+		{
+			assert((pointerEnemySpawners[i].x < pointerLevelData->widthBlocks) && (pointerEnemySpawners[i].y < pointerLevelData->heightBlocks));
+			_decodeObject(pointerLevelData, pointerEnemySpawners[i].x, pointerEnemySpawners[i].y, LevelFile::OBJECT_ID_ENEMY_SPAWNER, &isPlayerFound);
+		}
+		returnValue = 0;
+		
+	Exit:
+		FileManager::unmapFile(pointerFileContent, fileSize);
+		return returnValue;
+	}
+
+	/** Decode a level, the compiled level is used if it is available because it is much faster to load.
+	 * @param levelNumber The level number (starting from 0).
+	 * @param pointerLevelData On output, contain the decoded level.
+	 * @return -1 if an error occurred,
+	 * @return 0 if the level was successfully decoded.
+	 */
+	static int _decodeLevel(int levelNumber, LevelData *pointerLevelData)
+	{
+		int result;
+		
+		pointerLevelData->levelNumber = -1;
+		pointerLevelData->enemySpawners.clear();
+		
+		result = _decodeCompiledLevel(levelNumber, pointerLevelData);
+		if (result == 1)
+		{
+			LOG_DEBUG("No valid compiled level found, loading the level text files.");
+			pointerLevelData->enemySpawners.clear();
+			result = _decodeTextLevel(levelNumber, pointerLevelData);
+		}
+		if (result != 0) return -1;
+		
+		pointerLevelData->levelNumber = levelNumber;
+		return 0;
+	}
+
+	/** Decode the level requested by preloadLevel() in the background.
+	 * @return Always 0.
+	 */
+	static int _preloadingThread(void *)
+	{
+		// Errors are reported when the level is loaded, because the level number will not match
+		_decodeLevel(_preloadingLevelNumber, _pointerPreloadedLevelData);
+		
+		LOG_DEBUG("Level %d preloading thread exited.", _preloadingLevelNumber);
+		return 0;
+	}
+
+	void preloadLevel(int levelNumber)
+	{
+		// Only one level can be preloaded at a time
+		_waitForPreloadingThread();
+		
+		// Set the level number before the thread starts, so it is still meaningful if the thread can't be created
+		_pointerPreloadedLevelData->levelNumber = -1;
+		_preloadingLevelNumber = levelNumber;
+		
+		_pointerPreloadingThread = SDL_CreateThread(_preloadingThread, "Level preloading", NULL);
+		if (_pointerPreloadingThread == NULL) LOG_INFORMATION("Failed to create the level preloading thread, level %d will be loaded when it starts (%s).", levelNumber, SDL_GetError());
+	}
+
+	/** Set or clear a block bit in the obstacle row and column bitmasks.
+	 * @param xBlock The block X coordinate (in blocks).
+	 * @param yBlock The block Y coordinate (in blocks).
+	 * @param isObstacle Set to true to tell that the block is an obstacle, set to false to tell that it is not.
+	 */
+	static inline void _setObstacleBit(int xBlock, int yBlock, bool isObstacle)
+	{
+		uint64_t *pointerRowWord = &_obstacleRowsBitmasks[yBlock][xBlock / 64];
+		uint64_t *pointerColumnWord = &_obstacleColumnsBitmasks[xBlock][yBlock / 64];
+		uint64_t rowBit = 1ULL << (xBlock % 64), columnBit = 1ULL << (yBlock % 64);
+		
+		if (isObstacle)
+		{
+			*pointerRowWord |= rowBit;
+			*pointerColumnWord |= columnBit;
+		}
+		else
+		{
+			*pointerRowWord &= ~rowBit;
+			*pointerColumnWord &= ~columnBit;
+		}
+	}
+
+	/** Tell whether one of the bits of a bitmask range is set.
+	 * @param pointerBitmask The bitmask words.
+	 * @param firstBit The first bit of the range.
+	 * @param endBit The bit following the last bit of the range.
+	 * @return true if at least one bit is set,
+	 * @return false if all bits are cleared or if the range is empty.
+	 */
+	static inline bool _isBitmaskRangeSet(const uint64_t *pointerBitmask, int firstBit, int endBit)
+	{
+		int wordIndex, lastWordIndex;
+		uint64_t mask;
+		
+		if (firstBit >= endBit) return false;
+		
+		// Check the whole words first, ignoring the bits preceding the range in the first word
+		wordIndex = firstBit / 64;
+		lastWordIndex = (endBit - 1) / 64;
+		mask = ~0ULL << (firstBit % 64);
+		while (wordIndex < lastWordIndex)
+		{
+			if (pointerBitmask[wordIndex] & mask) return true;
+			mask = ~0ULL;
+			wordIndex++;
+		}
+		
+		// Ignore the bits following the range in the last word
+		mask &= ~0ULL >> (63 - ((endBit - 1) % 64));
+		return (pointerBitmask[wordIndex] & mask) != 0;
+	}
+
+	/** Compute the obstacle distance of consecutive blocks of a row or a column, in one direction. A block distance is deduced from the distance of the block preceding it in the direction, so the blocks must be computed going away from the direction.
+	 * @param fieldId The obstacle distance field to update.
+	 * @param direction The direction the distance is computed to.
+	 * @param blockIndex The first block to compute, the block preceding it in the direction must be valid.
+	 * @param blockIndexIncrement How to go from a block to the next one to compute.
+	 * @param blocksCount How many blocks to compute at most.
+	 * @param isStoppedAtObstacle Set to true to stop after computing an obstacle block (the following blocks distances can't have changed), set to false to compute all blocks.
+	 */
+	static void _computeObstacleDistances(ObstacleDistanceFieldId fieldId, MovingEntity::Direction direction, int blockIndex, int blockIndexIncrement, int blocksCount, bool isStoppedAtObstacle)
+	{
+		uint8_t *pointerDistances = &_obstacleDistanceFields[fieldId][0];
+		int obstacleBlockContent = _obstacleDistanceFieldsBlockContents[fieldId], previousBlockIndex, distance;
+		
+		while (blocksCount > 0)
+		{
+			previousBlockIndex = blockIndex - blockIndexIncrement;
+			if (_levelBlocksContent[previousBlockIndex] & obstacleBlockContent) distance = 0;
+			else
+			{
+				distance = pointerDistances[(previousBlockIndex * MovingEntity::DIRECTIONS_COUNT) + direction] + 1;
+				if (distance > 255) distance = 255;
+			}
+			pointerDistances[(blockIndex * MovingEntity::DIRECTIONS_COUNT) + direction] = static_cast<uint8_t>(distance);
+			
+			if (isStoppedAtObstacle && (_levelBlocksContent[blockIndex] & obstacleBlockContent)) break;
+			blockIndex += blockIndexIncrement;
+			blocksCount--;
+		}
+	}
+
+	/** Compute again the obstacle distances changed by a block becoming an obstacle or stopping being one. Only the blocks of the same row and column, up to the next obstacle, are affected.
+	 * @param fieldId The obstacle distance field to update.
+	 * @param xBlock The changed block X coordinate (in blocks).
+	 * @param yBlock The changed block Y coordinate (in blocks).
+	 */
+	static void _updateObstacleDistances(ObstacleDistanceFieldId fieldId, int xBlock, int yBlock)
+	{
+		if (yBlock < _levelHeightBlocks - 1) _computeObstacleDistances(fieldId, MovingEntity::DIRECTION_UP, COMPUTE_BLOCK_INDEX(xBlock, yBlock + 1), _levelWidthBlocks, _levelHeightBlocks - 1 - yBlock, true);
+		if (yBlock > 0) _computeObstacleDistances(fieldId, MovingEntity::DIRECTION_DOWN, COMPUTE_BLOCK_INDEX(xBlock, yBlock - 1), -_levelWidthBlocks, yBlock, true);
+		if (xBlock < _levelWidthBlocks - 1) _computeObstacleDistances(fieldId, MovingEntity::DIRECTION_LEFT, COMPUTE_BLOCK_INDEX(xBlock + 1, yBlock), 1, _levelWidthBlocks - 1 - xBlock, true);
+		if (xBlock > 0) _computeObstacleDistances(fieldId, MovingEntity::DIRECTION_RIGHT, COMPUTE_BLOCK_INDEX(xBlock - 1, yBlock), -1, xBlock, true);
+	}
+
+	/** Tell whether a block is on the level border or out of the level, where the next block in any direction may not exist.
+	 * @param xBlock The block horizontal coordinate.
+	 * @param yBlock The block vertical coordinate.
+	 * @return true if the block is on the level border or out of the level bounds,
+	 * @return false if the block and all its neighbors are inside the level.
+	 */
+	static inline bool _isBlockOnLevelBorder(int xBlock, int yBlock)
+	{
+		return (xBlock <= 0) || (xBlock >= _levelWidthBlocks - 1) || (yBlock <= 0) || (yBlock >= _levelHeightBlocks - 1);
+	}
+
+	/** Tell how many blocks can be crossed from a block before reaching an obstacle.
+	 * @param blockIndex The starting block, it must not be an obstacle nor be on the level border (see _isBlockOnLevelBorder()).
+	 * @param nextBlockIndex The block following the starting block in the direction.
+	 * @param direction The direction to look at.
+	 * @param blockContent The block content bits to consider as obstacles.
+	 * @return The count of blocks that can be crossed.
+	 */
+	static inline int _getObstacleDistance(int blockIndex, int nextBlockIndex, MovingEntity::Direction direction, int blockContent)
+	{
+		ObstacleDistanceFieldId fieldId;
+		
+		// The enemies move all the time, so keeping a distance field up to date with them would cost more than it saves, only the next block is checked for them
+		if (blockContent & BLOCK_CONTENT_ENEMY)
+		{
+			if (_levelBlocksContent[nextBlockIndex] & BLOCK_CONTENT_ENEMY) return 0;
+			blockContent &= ~BLOCK_CONTENT_ENEMY;
+		}
+		
+		if (blockContent == BLOCK_CONTENT_WALL) fieldId = OBSTACLE_DISTANCE_FIELD_ID_WALLS;
+		else if (blockContent == (BLOCK_CONTENT_WALL | BLOCK_CONTENT_ENEMY_SPAWNER)) fieldId = OBSTACLE_DISTANCE_FIELD_ID_WALLS_AND_ENEMY_SPAWNERS;
+		// There is no distance field for these block contents, check the next block only
+		else
+		{
+			if (_levelBlocksContent[nextBlockIndex] & blockContent) return 0;
+			return 1;
+		}
+		
+		return _obstacleDistanceFields[fieldId][(blockIndex * MovingEntity::DIRECTIONS_COUNT) + direction];
+	}
+
+	int loadLevel(int levelNumber)
+	{
+		LevelData *pointerLevelData;
+		Texture *pointerTexture;
+		unsigned int i;
+		int x, y, fieldId;
+		ObstacleDistanceFieldId obstacleDistanceFieldId;
+		
+		LOG_DEBUG("Loading level %d...", levelNumber);
+		
+		// Use the preloaded level if it is the requested one, otherwise decode the level now
+		_waitForPreloadingThread();
+		if (_pointerPreloadedLevelData->levelNumber != levelNumber)
+		{
+			if (_decodeLevel(levelNumber, _pointerPreloadedLevelData) != 0) return -1;
+		}
+		else LOG_DEBUG("Level %d has been preloaded.", levelNumber);
+		
+		// Swap the levels, the previous level blocks have been modified while playing so they can't be used anymore
+		pointerLevelData = _pointerPreloadedLevelData;
+		_pointerPreloadedLevelData = _pointerCurrentLevelData;
+		_pointerPreloadedLevelData->levelNumber = -1;
+		_pointerCurrentLevelData = pointerLevelData;
+		_levelWidthBlocks = pointerLevelData->widthBlocks;
+		_levelHeightBlocks = pointerLevelData->heightBlocks;
+		_levelBlocksContent = &pointerLevelData->blocksContent[0];
+		_levelBlocksTextureIds = &pointerLevelData->blocksTextureIds[0];
+		
+		// The whole scene must be displayed again
+		_isLevelChanged = true;
+		_sceneBlockChanges.clear();
+		
+		// The previous level paths are meaningless
+		_playerPathsOriginBlockIndex = -1;
+		
+		// Gather the obstacles of each row and column
+		memset(_obstacleRowsBitmasks, 0, sizeof(_obstacleRowsBitmasks));
+		memset(_obstacleColumnsBitmasks, 0, sizeof(_obstacleColumnsBitmasks));
+		for (y = 0; y < _levelHeightBlocks; y++)
+		{
+			for (x = 0; x < _levelWidthBlocks; x++)
+			{
+				if (_levelBlocksContent[COMPUTE_BLOCK_INDEX(x, y)] & OBSTACLE_BLOCK_CONTENT_MASK) _setObstacleBit(x, y, true);
+			}
+		}
+		
+		// Compute the obstacle distances, starting from the level borders (there is nothing to cross after a border block)
+		for (fieldId = 0; fieldId < OBSTACLE_DISTANCE_FIELD_IDS_COUNT; fieldId++)
+		{
+			obstacleDistanceFieldId = static_cast<ObstacleDistanceFieldId>(fieldId);
+			_obstacleDistanceFields[fieldId].assign(_levelWidthBlocks * _levelHeightBlocks * MovingEntity::DIRECTIONS_COUNT, 0);
+			for (x = 0; x < _levelWidthBlocks; x++)
+			{
+				_computeObstacleDistances(obstacleDistanceFieldId, MovingEntity::DIRECTION_UP, COMPUTE_BLOCK_INDEX(x, 1), _levelWidthBlocks, _levelHeightBlocks - 1, false);
+				_computeObstacleDistances(obstacleDistanceFieldId, MovingEntity::DIRECTION_DOWN, COMPUTE_BLOCK_INDEX(x, _levelHeightBlocks - 2), -_levelWidthBlocks, _levelHeightBlocks - 1, false);
+			}
+			for (y = 0; y < _levelHeightBlocks; y++)
+			{
+				_computeObstacleDistances(obstacleDistanceFieldId, MovingEntity::DIRECTION_LEFT, COMPUTE_BLOCK_INDEX(1, y), 1, _levelWidthBlocks - 1, false);
+				_computeObstacleDistances(obstacleDistanceFieldId, MovingEntity::DIRECTION_RIGHT, COMPUTE_BLOCK_INDEX(_levelWidthBlocks - 2, y), -1, _levelWidthBlocks - 1, false);
+			}
+		}
+		
+		// Put the player at the block center (get player size from its texture)
+		pointerTexture = TextureManager::getTextureFromId(TextureManager::TEXTURE_ID_PLAYER_FACING_UP);
+		pointerPlayer->setX((pointerLevelData->playerX * CONFIGURATION_LEVEL_BLOCK_SIZE) + ((CONFIGURATION_LEVEL_BLOCK_SIZE - pointerTexture->getWidth()) / 2));
+		pointerPlayer->setY((pointerLevelData->playerY * CONFIGURATION_LEVEL_BLOCK_SIZE) + ((CONFIGURATION_LEVEL_BLOCK_SIZE - pointerTexture->getHeight()) / 2));
+		LOG_DEBUG("Spawned player on block (%d, %d).", pointerLevelData->playerX, pointerLevelData->playerY);
+		
+		// Spawn the enemy spawners
+		for (i = 0; i < pointerLevelData->enemySpawners.size(); i++)
+		{
+			enemySpawnersList.push_front(new EnemySpawnerStaticEntity(pointerLevelData->enemySpawners[i].x * CONFIGURATION_LEVEL_BLOCK_SIZE, pointerLevelData->enemySpawners[i].y * CONFIGURATION_LEVEL_BLOCK_SIZE));
+			LOG_DEBUG("Spawned enemy spawner on block (%d, %d).", pointerLevelData->enemySpawners[i].x, pointerLevelData->enemySpawners[i].y);
+		}
+		
+		LOG_DEBUG("Level size : %dx%d blocks.", _levelWidthBlocks, _levelHeightBlocks);
+		LOG_INFORMATION("Level %d successfully loaded.", levelNumber);
+		return 0;
+	}
+
+	void getSceneUpdate(SceneUpdate *pointerSceneUpdate)
+	{
+		int blocksCount;
+		
+		// Copy the whole level when it changed, because the game logic keeps modifying the level blocks while they are displayed
+		pointerSceneUpdate->isLevelChanged = _isLevelChanged;
+		if (_isLevelChanged)
+		{
+			blocksCount = _levelWidthBlocks * _levelHeightBlocks;
+			pointerSceneUpdate->widthBlocks = _levelWidthBlocks;
+			pointerSceneUpdate->heightBlocks = _levelHeightBlocks;
+			pointerSceneUpdate->blocksTextureIds.assign(_levelBlocksTextureIds, _levelBlocksTextureIds + blocksCount);
+			pointerSceneUpdate->blocksContent.assign(_levelBlocksContent, _levelBlocksContent + blocksCount);
+			_isLevelChanged = false;
+		}
+		
+		// Give the block changes to the update and reuse the update previous block changes memory
+		pointerSceneUpdate->blockChanges.swap(_sceneBlockChanges);
+		_sceneBlockChanges.clear();
+	}
+
+	/** Render a block texture and the item that can be on the block to the current render target.
+	 * @param blockIndex The block index.
+	 * @param x Horizontal coordinate of the block top left corner.
+	 * @param y Vertical coordinate of the block top left corner.
+	 */
+	static inline void _renderBlock(int blockIndex, int x, int y)
+	{
+		int blockContent = _sceneBlocksContent[blockIndex];
+		
+		// Display the block texture
+		_pointerSceneTextures[_sceneBlocksTextureIds[blockIndex]]->render(x, y);
+		
+		// Display an eventual item which can be on the block
+		if (blockContent & BLOCK_CONTENT_MEDIPACK) _pointerMedipackTexture->render(x, y);
+		else if (blockContent & BLOCK_CONTENT_GOLDEN_MEDIPACK) _pointerGoldenMedipackTexture->render(x, y);
+		else if (blockContent & BLOCK_CONTENT_AMMUNITION) _pointerAmmunitionTexture->render(x, y);
+		else if (blockContent & BLOCK_CONTENT_MACHINE_GUN_BONUS) _pointerMachineGunBonusTexture->render(x, y);
+		else if (blockContent & BLOCK_CONTENT_BULLETPROOF_VEST_BONUS) _pointerBulletproofVestBonusTexture->render(x, y);
+	}
+
+	/** Render each visible block, this is used when render targets are not available.
+	 * @param topLeftX This is the scene horizontal coordinate to start drawing from.
+	 * @param topLeftY This is the scene vertical coordinate to start drawing from.
+	 */
+	static void _renderSceneBlocks(int topLeftX, int topLeftY)
 	{
 		// Get the amount of pixels the rendering must be shifted about in the beginning blocks
 		int xStartingPixel = -(topLeftX % CONFIGURATION_LEVEL_BLOCK_SIZE); // Invert result sign to make negative camera coordinates go to left and positive camera coordinates go to right
@@ -276,7 +887,6 @@ namespace LevelManager
 		
 		// Render a full display from the specified coordinates
 		int xDisplayBlock, yDisplayBlock, xBlock, yBlock, xPixel, yPixel = yStartingPixel;
-		Block *pointerBlock;
 		for (yDisplayBlock = 0; yDisplayBlock < yDisplayBlocksCount; yDisplayBlock++)
 		{
 			xPixel = xStartingPixel;
@@ -287,19 +897,7 @@ namespace LevelManager
 				yBlock = yStartingBlock + yDisplayBlock;
 				
 				// Render the block only if it is existing in the level
-				if ((xBlock >= 0) && (yBlock >= 0) && (xBlock < _levelWidthBlocks) && (yBlock < _levelHeightBlocks))
-				{
-					// Display the block texture
-					pointerBlock = &_levelBlocks[COMPUTE_BLOCK_INDEX(xBlock, yBlock)]; // Compute the block index only once
-					pointerBlock->pointerTexture->render(xPixel, yPixel);
-					
-					// Display an eventual item which can be on the block
-					if (pointerBlock->content & BLOCK_CONTENT_MEDIPACK) _pointerMedipackTexture->render(xPixel, yPixel);
-					else if (pointerBlock->content & BLOCK_CONTENT_GOLDEN_MEDIPACK) _pointerGoldenMedipackTexture->render(xPixel, yPixel);
-					else if (pointerBlock->content & BLOCK_CONTENT_AMMUNITION) _pointerAmmunitionTexture->render(xPixel, yPixel);
-					else if (pointerBlock->content & BLOCK_CONTENT_MACHINE_GUN_BONUS) _pointerMachineGunBonusTexture->render(xPixel, yPixel);
-					else if (pointerBlock->content & BLOCK_CONTENT_BULLETPROOF_VEST_BONUS) _pointerBulletproofVestBonusTexture->render(xPixel, yPixel);
-				}
+				if ((xBlock >= 0) && (yBlock >= 0) && (xBlock < _sceneWidthBlocks) && (yBlock < _sceneHeightBlocks)) _renderBlock((yBlock * _sceneWidthBlocks) + xBlock, xPixel, yPixel);
 				
 				xPixel += CONFIGURATION_LEVEL_BLOCK_SIZE;
 			}
@@ -307,23 +905,167 @@ namespace LevelManager
 		}
 	}
 
+	/** Get the texture containing a scene chunk, rendering the chunk if it is not in the cache.
+	 * @param xChunk X coordinate in scene chunks.
+	 * @param yChunk Y coordinate in scene chunks.
+	 * @return NULL if the chunk texture could not be created,
+	 * @return the chunk texture on success.
+	 */
+	static SDL_Texture *_getSceneChunkTexture(int xChunk, int yChunk)
+	{
+		int chunkIndex = (yChunk * _levelWidthSceneChunks) + xChunk, cacheIndex, i, xBlock, yBlock, xLastBlock, yLastBlock;
+		SceneChunk *pointerSceneChunk;
+		
+		// Is the chunk already rendered ?
+		cacheIndex = _sceneChunksCacheIndexes[chunkIndex];
+		if (cacheIndex >= 0)
+		{
+			pointerSceneChunk = &_pointerSceneChunks[cacheIndex];
+			pointerSceneChunk->lastDisplayedFrame = _sceneFramesCounter;
+			return pointerSceneChunk->pointerTexture;
+		}
+		
+		// Replace the least recently displayed chunk (the cache is big enough to never replace a chunk displayed in the current frame)
+		cacheIndex = 0;
+		for (i = 1; i < _sceneChunksCount; i++)
+		{
+			if (_pointerSceneChunks[i].lastDisplayedFrame < _pointerSceneChunks[cacheIndex].lastDisplayedFrame) cacheIndex = i;
+		}
+		pointerSceneChunk = &_pointerSceneChunks[cacheIndex];
+		if (pointerSceneChunk->chunkIndex >= 0) _sceneChunksCacheIndexes[pointerSceneChunk->chunkIndex] = -1;
+		
+		// Create the texture the first time the cache entry is used
+		if (pointerSceneChunk->pointerTexture == NULL)
+		{
+			pointerSceneChunk->pointerTexture = SDL_CreateTexture(Renderer::pointerRenderer, SDL_PIXELFORMAT_ARGB8888, SDL_TEXTUREACCESS_TARGET, SCENE_CHUNK_SIZE_PIXELS, SCENE_CHUNK_SIZE_PIXELS);
+			if (pointerSceneChunk->pointerTexture == NULL)
+			{
+				LOG_ERROR("Failed to create a scene chunk texture (%s).", SDL_GetError());
+				return NULL;
+			}
+		}
+		
+		// Render all chunk blocks that are existing in the level
+		Renderer::setRenderTarget(pointerSceneChunk->pointerTexture);
+		SDL_RenderClear(Renderer::pointerRenderer);
+		xLastBlock = (xChunk + 1) * CONFIGURATION_LEVEL_SCENE_CHUNK_SIZE;
+		if (xLastBlock > _sceneWidthBlocks) xLastBlock = _sceneWidthBlocks;
+		yLastBlock = (yChunk + 1) * CONFIGURATION_LEVEL_SCENE_CHUNK_SIZE;
+		if (yLastBlock > _sceneHeightBlocks) yLastBlock = _sceneHeightBlocks;
+		for (yBlock = yChunk * CONFIGURATION_LEVEL_SCENE_CHUNK_SIZE; yBlock < yLastBlock; yBlock++)
+		{
+			for (xBlock = xChunk * CONFIGURATION_LEVEL_SCENE_CHUNK_SIZE; xBlock < xLastBlock; xBlock++) _renderBlock((yBlock * _sceneWidthBlocks) + xBlock, (xBlock % CONFIGURATION_LEVEL_SCENE_CHUNK_SIZE) * CONFIGURATION_LEVEL_BLOCK_SIZE, (yBlock % CONFIGURATION_LEVEL_SCENE_CHUNK_SIZE) * CONFIGURATION_LEVEL_BLOCK_SIZE);
+		}
+		Renderer::setRenderTarget(NULL);
+		
+		pointerSceneChunk->chunkIndex = chunkIndex;
+		pointerSceneChunk->lastDisplayedFrame = _sceneFramesCounter;
+		_sceneChunksCacheIndexes[chunkIndex] = cacheIndex;
+		return pointerSceneChunk->pointerTexture;
+	}
+
+	/** Render the block containing a content change again if its scene chunk is cached.
+	 * @param xBlock X coordinate in blocks.
+	 * @param yBlock Y coordinate in blocks.
+	 */
+	static inline void _invalidateSceneChunk(int xBlock, int yBlock)
+	{
+		int chunkIndex, cacheIndex;
+		
+		if (_pointerSceneChunks == NULL) return;
+		
+		chunkIndex = ((yBlock / CONFIGURATION_LEVEL_SCENE_CHUNK_SIZE) * _levelWidthSceneChunks) + (xBlock / CONFIGURATION_LEVEL_SCENE_CHUNK_SIZE);
+		cacheIndex = _sceneChunksCacheIndexes[chunkIndex];
+		if (cacheIndex < 0) return;
+		
+		// The chunk will be rendered again the next time it is displayed
+		_pointerSceneChunks[cacheIndex].chunkIndex = -1;
+		_sceneChunksCacheIndexes[chunkIndex] = -1;
+	}
+
+	void applySceneUpdate(SceneUpdate *pointerSceneUpdate)
+	{
+		size_t i;
+		int blockIndex;
+		
+		// Take the new level blocks and give the previous level ones to the update, so their memory is reused
+		if (pointerSceneUpdate->isLevelChanged)
+		{
+			_sceneWidthBlocks = pointerSceneUpdate->widthBlocks;
+			_sceneHeightBlocks = pointerSceneUpdate->heightBlocks;
+			_sceneBlocksTextureIds.swap(pointerSceneUpdate->blocksTextureIds);
+			_sceneBlocksContent.swap(pointerSceneUpdate->blocksContent);
+			_levelWidthSceneChunks = (_sceneWidthBlocks + CONFIGURATION_LEVEL_SCENE_CHUNK_SIZE - 1) / CONFIGURATION_LEVEL_SCENE_CHUNK_SIZE;
+			_levelHeightSceneChunks = (_sceneHeightBlocks + CONFIGURATION_LEVEL_SCENE_CHUNK_SIZE - 1) / CONFIGURATION_LEVEL_SCENE_CHUNK_SIZE;
+			_invalidateSceneCache();
+			pointerSceneUpdate->isLevelChanged = false;
+		}
+		
+		// Render the changed blocks again if their scene chunk is cached
+		for (i = 0; i < pointerSceneUpdate->blockChanges.size(); i++)
+		{
+			blockIndex = pointerSceneUpdate->blockChanges[i].blockIndex;
+			_sceneBlocksContent[blockIndex] = pointerSceneUpdate->blockChanges[i].content;
+			_invalidateSceneChunk(blockIndex % _sceneWidthBlocks, blockIndex / _sceneWidthBlocks);
+		}
+		pointerSceneUpdate->blockChanges.clear();
+	}
+
+	void renderScene(int topLeftX, int topLeftY)
+	{
+		int xFirstChunk, yFirstChunk, xLastChunk, yLastChunk, xChunk, yChunk;
+		SDL_Texture *pointerTexture;
+		SDL_Rect positionRectangle;
+		
+		if (_pointerSceneChunks == NULL)
+		{
+			_renderSceneBlocks(topLeftX, topLeftY);
+			return;
+		}
+		_sceneFramesCounter++;
+		
+		// Find the chunks overlapping the display (coordinates are offset before dividing to round negative coordinates toward minus infinity)
+		xFirstChunk = ((topLeftX + SCENE_CHUNK_SIZE_PIXELS) / SCENE_CHUNK_SIZE_PIXELS) - 1;
+		if (xFirstChunk < 0) xFirstChunk = 0;
+		yFirstChunk = ((topLeftY + SCENE_CHUNK_SIZE_PIXELS) / SCENE_CHUNK_SIZE_PIXELS) - 1;
+		if (yFirstChunk < 0) yFirstChunk = 0;
+		xLastChunk = (topLeftX + Renderer::displayWidth - 1) / SCENE_CHUNK_SIZE_PIXELS;
+		if (xLastChunk >= _levelWidthSceneChunks) xLastChunk = _levelWidthSceneChunks - 1;
+		yLastChunk = (topLeftY + Renderer::displayHeight - 1) / SCENE_CHUNK_SIZE_PIXELS;
+		if (yLastChunk >= _levelHeightSceneChunks) yLastChunk = _levelHeightSceneChunks - 1;
+		
+		// Display the chunks
+		positionRectangle.w = SCENE_CHUNK_SIZE_PIXELS;
+		positionRectangle.h = SCENE_CHUNK_SIZE_PIXELS;
+		for (yChunk = yFirstChunk; yChunk <= yLastChunk; yChunk++)
+		{
+			for (xChunk = xFirstChunk; xChunk <= xLastChunk; xChunk++)
+			{
+				pointerTexture = _getSceneChunkTexture(xChunk, yChunk);
+				if (pointerTexture == NULL) continue;
+				
+				positionRectangle.x = (xChunk * SCENE_CHUNK_SIZE_PIXELS) - topLeftX;
+				positionRectangle.y = (yChunk * SCENE_CHUNK_SIZE_PIXELS) - topLeftY;
+				Renderer::renderBatchedTexture(pointerTexture, NULL, &positionRectangle);
+			}
+		}
+	}
+
 	int getDistanceFromUpperBlock(int x, int y, int blockContent)
 	{
 		// Convert to block coordinates
 		int xBlock = x / CONFIGURATION_LEVEL_BLOCK_SIZE;
 		int yBlock = y / CONFIGURATION_LEVEL_BLOCK_SIZE;
 		
-		// Tell that the walls are close if the requested coordinates are (out of) level bounds
-		if ((xBlock <= 0) || (xBlock >= _levelWidthBlocks - 1) || (yBlock <= 0) || (yBlock >= _levelWidthBlocks - 1)) return 0;
+		// Tell that the walls are close if the requested coordinates are (out of) level bounds, so the next block always exists
+		if (_isBlockOnLevelBorder(xBlock, yBlock)) return 0;
 		
 		// Is this block a wall ?
-		if (_levelBlocks[COMPUTE_BLOCK_INDEX(xBlock, yBlock)].content & blockContent) return 0;
-		
-		// Is upper block part of the floor ?
-		if (!(_levelBlocks[COMPUTE_BLOCK_INDEX(xBlock, yBlock - 1)].content & blockContent)) return CONFIGURATION_LEVEL_BLOCK_SIZE; // Do not check further to optimize function speed
+		if (_levelBlocksContent[COMPUTE_BLOCK_INDEX(xBlock, yBlock)] & blockContent) return 0;
 		
-		// The upper block is a wall, compute the amount of pixels separating the provided coordinates from the wall
-		return y % CONFIGURATION_LEVEL_BLOCK_SIZE;
+		// Add the distance to the block border to the crossable blocks distance
+		int crossableBlocksCount = _getObstacleDistance(COMPUTE_BLOCK_INDEX(xBlock, yBlock), COMPUTE_BLOCK_INDEX(xBlock, yBlock - 1), MovingEntity::DIRECTION_UP, blockContent);
+		return (crossableBlocksCount * CONFIGURATION_LEVEL_BLOCK_SIZE) + (y % CONFIGURATION_LEVEL_BLOCK_SIZE);
 	}
 
 	int getDistanceFromDownerBlock(int x, int y, int blockContent)
@@ -332,17 +1074,15 @@ namespace LevelManager
 		int xBlock = x / CONFIGURATION_LEVEL_BLOCK_SIZE;
 		int yBlock = y / CONFIGURATION_LEVEL_BLOCK_SIZE;
 		
-		// Tell that the walls are close if the requested coordinates are (out of) level bounds
-		if ((xBlock <= 0) || (xBlock >= _levelWidthBlocks - 1) || (yBlock <= 0) || (yBlock >= _levelWidthBlocks - 1)) return 0;
+		// Tell that the walls are close if the requested coordinates are (out of) level bounds, so the next block always exists
+		if (_isBlockOnLevelBorder(xBlock, yBlock)) return 0;
 		
 		// Is this block a wall ?
-		if (_levelBlocks[COMPUTE_BLOCK_INDEX(xBlock, yBlock)].content & blockContent) return 0;
-		
-		// Is upper block part of the floor ?
-		if (!(_levelBlocks[COMPUTE_BLOCK_INDEX(xBlock, yBlock + 1)].content & blockContent)) return CONFIGURATION_LEVEL_BLOCK_SIZE; // Do not check further to optimize function speed
+		if (_levelBlocksContent[COMPUTE_BLOCK_INDEX(xBlock, yBlock)] & blockContent) return 0;
 		
-		// The upper block is a wall, compute the amount of pixels separating the provided coordinates from the wall
-		return CONFIGURATION_LEVEL_BLOCK_SIZE - (y % CONFIGURATION_LEVEL_BLOCK_SIZE);
+		// Add the distance to the block border to the crossable blocks distance
+		int crossableBlocksCount = _getObstacleDistance(COMPUTE_BLOCK_INDEX(xBlock, yBlock), COMPUTE_BLOCK_INDEX(xBlock, yBlock + 1), MovingEntity::DIRECTION_DOWN, blockContent);
+		return (crossableBlocksCount * CONFIGURATION_LEVEL_BLOCK_SIZE) + CONFIGURATION_LEVEL_BLOCK_SIZE - (y % CONFIGURATION_LEVEL_BLOCK_SIZE);
 	}
 
 	int getDistanceFromLeftmostBlock(int x, int y, int blockContent)
@@ -351,17 +1091,15 @@ namespace LevelManager
 		int xBlock = x / CONFIGURATION_LEVEL_BLOCK_SIZE;
 		int yBlock = y / CONFIGURATION_LEVEL_BLOCK_SIZE;
 		
-		// Tell that the walls are close if the requested coordinates are (out of) level bounds
-		if ((xBlock <= 0) || (xBlock >= _levelWidthBlocks - 1) || (yBlock <= 0) || (yBlock >= _levelWidthBlocks - 1)) return 0;
+		// Tell that the walls are close if the requested coordinates are (out of) level bounds, so the next block always exists
+		if (_isBlockOnLevelBorder(xBlock, yBlock)) return 0;
 		
 		// Is this block a wall ?
-		if (_levelBlocks[COMPUTE_BLOCK_INDEX(xBlock, yBlock)].content & blockContent) return 0;
+		if (_levelBlocksContent[COMPUTE_BLOCK_INDEX(xBlock, yBlock)] & blockContent) return 0;
 		
-		// Is upper block part of the floor ?
-		if (!(_levelBlocks[COMPUTE_BLOCK_INDEX(xBlock - 1, yBlock)].content & blockContent)) return CONFIGURATION_LEVEL_BLOCK_SIZE; // Do not check further to optimize function speed
-		
-		// The upper block is a wall, compute the amount of pixels separating the provided coordinates from the wall
-		return x % CONFIGURATION_LEVEL_BLOCK_SIZE;
+		// Add the distance to the block border to the crossable blocks distance
+		int crossableBlocksCount = _getObstacleDistance(COMPUTE_BLOCK_INDEX(xBlock, yBlock), COMPUTE_BLOCK_INDEX(xBlock - 1, yBlock), MovingEntity::DIRECTION_LEFT, blockContent);
+		return (crossableBlocksCount * CONFIGURATION_LEVEL_BLOCK_SIZE) + (x % CONFIGURATION_LEVEL_BLOCK_SIZE);
 	}
 
 	int getDistanceFromRightmostBlock(int x, int y, int blockContent)
@@ -370,17 +1108,15 @@ namespace LevelManager
 		int xBlock = x / CONFIGURATION_LEVEL_BLOCK_SIZE;
 		int yBlock = y / CONFIGURATION_LEVEL_BLOCK_SIZE;
 		
-		// Tell that the walls are close if the requested coordinates are (out of) level bounds
-		if ((xBlock <= 0) || (xBlock >= _levelWidthBlocks - 1) || (yBlock <= 0) || (yBlock >= _levelWidthBlocks - 1)) return 0;
+		// Tell that the walls are close if the requested coordinates are (out of) level bounds, so the next block always exists
+		if (_isBlockOnLevelBorder(xBlock, yBlock)) return 0;
 		
 		// Is this block a wall ?
-		if (_levelBlocks[COMPUTE_BLOCK_INDEX(xBlock, yBlock)].content & blockContent) return 0;
-		
-		// Is upper block part of the floor ?
-		if (!(_levelBlocks[COMPUTE_BLOCK_INDEX(xBlock + 1, yBlock)].content & blockContent)) return CONFIGURATION_LEVEL_BLOCK_SIZE; // Do not check further to optimize function speed
+		if (_levelBlocksContent[COMPUTE_BLOCK_INDEX(xBlock, yBlock)] & blockContent) return 0;
 		
-		// The upper block is a wall, compute the amount of pixels separating the provided coordinates from the wall
-		return CONFIGURATION_LEVEL_BLOCK_SIZE - (x % CONFIGURATION_LEVEL_BLOCK_SIZE);
+		// Add the distance to the block border to the crossable blocks distance
+		int crossableBlocksCount = _getObstacleDistance(COMPUTE_BLOCK_INDEX(xBlock, yBlock), COMPUTE_BLOCK_INDEX(xBlock + 1, yBlock), MovingEntity::DIRECTION_RIGHT, blockContent);
+		return (crossableBlocksCount * CONFIGURATION_LEVEL_BLOCK_SIZE) + CONFIGURATION_LEVEL_BLOCK_SIZE - (x % CONFIGURATION_LEVEL_BLOCK_SIZE);
 	}
 
 	bool isObstaclePresentOnVerticalAxis(int topmostY, int downerY, int x)
@@ -398,14 +1134,8 @@ namespace LevelManager
 		assert(x >= 0);
 		assert(x < _levelWidthBlocks);
 		
-		// Check all blocks along between the specified coordinates
-		while (topmostY < downerY)
-		{
-			if (_levelBlocks[COMPUTE_BLOCK_INDEX(x, topmostY)].content & (BLOCK_CONTENT_WALL | BLOCK_CONTENT_ENEMY_SPAWNER)) return true;
-			topmostY++;
-		}
-		
-		return false;
+		// Check all blocks between the specified coordinates at once
+		return _isBitmaskRangeSet(_obstacleColumnsBitmasks[x], topmostY, downerY);
 	}
 
 	bool isObstaclePresentOnHorizontalAxis(int leftmostX, int rightmostX, int y)
@@ -423,14 +1153,94 @@ namespace LevelManager
 		assert(y >= 0);
 		assert(y < _levelHeightBlocks);
 		
-		// Check all blocks along between the specified coordinates
-		while (leftmostX < rightmostX)
+		// Check all blocks between the specified coordinates at once
+		return _isBitmaskRangeSet(_obstacleRowsBitmasks[y], leftmostX, rightmostX);
+	}
+
+	/** Reach a block from a neighbor block during the player paths computation, if the block has not been reached yet.
+	 * @param blockIndex The block to reach.
+	 * @param distance The block distance from the player.
+	 * @param direction The direction to go from the block to reach its neighbor.
+	 */
+	static inline void _reachPlayerPathBlock(int blockIndex, int distance, MovingEntity::Direction direction)
+	{
+		PlayerPathBlock *pointerPlayerPathBlock = &_playerPathBlocks[blockIndex];
+		
+		// The block has already been reached by a shorter way, or it can't be walked on
+		if (pointerPlayerPathBlock->distance != PLAYER_PATH_UNREACHABLE_DISTANCE) return;
+		if (_levelBlocksContent[blockIndex] & OBSTACLE_BLOCK_CONTENT_MASK) return;
+		
+		pointerPlayerPathBlock->distance = static_cast<uint16_t>(distance);
+		pointerPlayerPathBlock->direction = static_cast<uint8_t>(direction);
+		_playerPathBlocksQueue.push_back(blockIndex);
+	}
+
+	void updatePlayerPaths(int playerX, int playerY)
+	{
+		int xBlock, yBlock, blockIndex, distance, blocksCount;
+		unsigned int i;
+		
+		// Convert coordinates to blocks
+		xBlock = playerX / CONFIGURATION_LEVEL_BLOCK_SIZE;
+		yBlock = playerY / CONFIGURATION_LEVEL_BLOCK_SIZE;
+		assert(xBlock >= 0);
+		assert(xBlock < _levelWidthBlocks);
+		assert(yBlock >= 0);
+		assert(yBlock < _levelHeightBlocks);
+		
+		// The paths are still valid while the player stays on the same block
+		blockIndex = COMPUTE_BLOCK_INDEX(xBlock, yBlock);
+		if (blockIndex == _playerPathsOriginBlockIndex) return;
+		_playerPathsOriginBlockIndex = blockIndex;
+		
+		// No block has been reached yet (the vectors memory is reused from a computation to another)
+		blocksCount = _levelWidthBlocks * _levelHeightBlocks;
+		PlayerPathBlock unreachedBlock = {PLAYER_PATH_UNREACHABLE_DISTANCE, MovingEntity::DIRECTIONS_COUNT};
+		_playerPathBlocks.assign(blocksCount, unreachedBlock);
+		_playerPathBlocksQueue.clear();
+		
+		// Start from the player block
+		_playerPathBlocks[blockIndex].distance = 0;
+		_playerPathBlocksQueue.push_back(blockIndex);
+		
+		// Breadth-first search, so each block is reached by one of its shortest ways
+		for (i = 0; i < _playerPathBlocksQueue.size(); i++)
 		{
-			if (_levelBlocks[COMPUTE_BLOCK_INDEX(leftmostX, y)].content & (BLOCK_CONTENT_WALL | BLOCK_CONTENT_ENEMY_SPAWNER)) return true;
-			leftmostX++;
+			blockIndex = _playerPathBlocksQueue[i];
+			xBlock = blockIndex % _levelWidthBlocks;
+			yBlock = blockIndex / _levelWidthBlocks;
+			distance = _playerPathBlocks[blockIndex].distance + 1;
+			
+			// A neighbor block reaches this block by going in the opposite direction
+			if (yBlock > 0) _reachPlayerPathBlock(blockIndex - _levelWidthBlocks, distance, MovingEntity::DIRECTION_DOWN);
+			if (yBlock < _levelHeightBlocks - 1) _reachPlayerPathBlock(blockIndex + _levelWidthBlocks, distance, MovingEntity::DIRECTION_UP);
+			if (xBlock > 0) _reachPlayerPathBlock(blockIndex - 1, distance, MovingEntity::DIRECTION_RIGHT);
+			if (xBlock < _levelWidthBlocks - 1) _reachPlayerPathBlock(blockIndex + 1, distance, MovingEntity::DIRECTION_LEFT);
 		}
+	}
+
+	int getPlayerPathDirection(int x, int y, MovingEntity::Direction *pointerDirection)
+	{
+		PlayerPathBlock *pointerPlayerPathBlock;
 		
-		return false;
+		// Convert coordinates to blocks
+		int xBlock = x / CONFIGURATION_LEVEL_BLOCK_SIZE;
+		int yBlock = y / CONFIGURATION_LEVEL_BLOCK_SIZE;
+		
+		// Make sure the block is existing
+		assert(xBlock >= 0);
+		assert(xBlock < _levelWidthBlocks);
+		assert(yBlock >= 0);
+		assert(yBlock < _levelHeightBlocks);
+		
+		// The paths have not been computed for this level yet
+		if (_playerPathsOriginBlockIndex == -1) return -1;
+		
+		pointerPlayerPathBlock = &_playerPathBlocks[COMPUTE_BLOCK_INDEX(xBlock, yBlock)];
+		if (pointerPlayerPathBlock->distance == PLAYER_PATH_UNREACHABLE_DISTANCE) return -1;
+		
+		if (pointerPlayerPathBlock->distance > 0) *pointerDirection = static_cast<MovingEntity::Direction>(pointerPlayerPathBlock->direction);
+		return pointerPlayerPathBlock->distance;
 	}
 
 	int getBlockContent(int x, int y)
@@ -445,7 +1255,7 @@ namespace LevelManager
 		assert(yBlock >= 0);
 		assert(yBlock < _levelHeightBlocks);
 		
-		return _levelBlocks[COMPUTE_BLOCK_INDEX(xBlock, yBlock)].content;
+		return _levelBlocksContent[COMPUTE_BLOCK_INDEX(xBlock, yBlock)];
 	}
 
 	void setBlockContent(int x, int y, int content)
@@ -460,7 +1270,29 @@ namespace LevelManager
 		assert(yBlock >= 0);
 		assert(yBlock < _levelHeightBlocks);
 		
-		_levelBlocks[COMPUTE_BLOCK_INDEX(xBlock, yBlock)].content = content;
+		// Display the block again if an item has been taken or dropped
+		if ((_levelBlocksContent[COMPUTE_BLOCK_INDEX(xBlock, yBlock)] ^ content) & SCENE_VISIBLE_BLOCK_CONTENT_MASK)
+		{
+			SceneBlockChange sceneBlockChange;
+			sceneBlockChange.blockIndex = COMPUTE_BLOCK_INDEX(xBlock, yBlock);
+			sceneBlockChange.content = static_cast<uint16_t>(content);
+			_sceneBlockChanges.push_back(sceneBlockChange);
+		}
+		
+		int changedBlockContent = _levelBlocksContent[COMPUTE_BLOCK_INDEX(xBlock, yBlock)] ^ content;
+		_levelBlocksContent[COMPUTE_BLOCK_INDEX(xBlock, yBlock)] = static_cast<uint16_t>(content);
+		
+		// The obstacles and the ways to the player change when an obstacle appears or disappears (an enemy spawner is destroyed, for instance)
+		if (changedBlockContent & OBSTACLE_BLOCK_CONTENT_MASK)
+		{
+			_setObstacleBit(xBlock, yBlock, (content & OBSTACLE_BLOCK_CONTENT_MASK) != 0);
+			_playerPathsOriginBlockIndex = -1;
+			
+			for (int i = 0; i < OBSTACLE_DISTANCE_FIELD_IDS_COUNT; i++)
+			{
+				if (changedBlockContent & _obstacleDistanceFieldsBlockContents[i]) _updateObstacleDistances(static_cast<ObstacleDistanceFieldId>(i), xBlock, yBlock);
+			}
+		}
 	}
 
 	void spawnItem(int x, int y)
@@ -4,7 +4,8 @@
  */
 #include <AudioManager.hpp>
 #include <BigEnemyFightingEntity.hpp>
-#include <BulletMovingEntity.hpp>
+#include <BulletStore.hpp>
+#include <CollisionManager.hpp>
 #include <Configuration.hpp>
 #include <ControlManager.hpp>
 #include <cstdlib>
@@ -14,28 +15,36 @@
 #include <EnemySpawnerStaticEntity.hpp>
 #include <FileManager.hpp>
 #include <HeadUpDisplay.hpp>
+#include <LevelArena.hpp>
 #include <list>
 #include <Log.hpp>
 #include <LevelManager.hpp>
 #include <MediumEnemyFightingEntity.hpp>
 #include <Menu.hpp>
+#include <ObjectPool.hpp>
 #include <PlayerFightingEntity.hpp>
 #include <Renderer.hpp>
 #include <SavegameManager.hpp>
 #include <SDL2/SDL.h>
 #include <SmallEnemyFightingEntity.hpp>
+#include <SnapshotManager.hpp>
 #include <TextureManager.hpp>
+#include <TimeManager.hpp>
+#include <vector>
+#include <WorkerPool.hpp>
 
 //-------------------------------------------------------------------------------------------------
 // Private variables
 //-------------------------------------------------------------------------------------------------
 /** All bullets shot by the player. */
-static std::list<BulletMovingEntity *> _playerBulletsList;
+static BulletStore _playerBullets;
 /** All bullets shot by the enemies. */
-static std::list<BulletMovingEntity *> _enemiesBulletsList;
+static BulletStore _enemiesBullets;
 
 /** All enemies. */
-static std::list<EnemyFightingEntity *> _enemiesList;
+static std::list<EnemyFightingEntity *, LevelArena::Allocator<EnemyFightingEntity *> > _enemiesList;
+/** The enemies deciding their action during the current game tick, stored in an array so the worker threads can access them by index. */
+static std::vector<EnemyFightingEntity *> _decidingEnemies;
 
 /** How many pixels to subtract to the player X coordinate to obtain the scene camera X coordinate. */
 static int _cameraOffsetX;
@@ -63,6 +72,23 @@ static SDL_Texture *_pointerGameLostInterfaceStringTexture;
 /** The string to display when the player won the game. */
 static SDL_Texture *_pointerGameWonInterfaceStringTexture;
 
+/** The game logic tick period, expressed in performance counter units to avoid losing precision at each tick. */
+static Uint64 _tickPeriod;
+
+/** The game logic is updated by this thread, while the main thread displays the snapshots the game logic publishes. */
+static SDL_Thread *_pointerGameLogicThread = NULL;
+/** Protect the game state, which is modified by the game logic thread and by the main thread when handling the controls and the menus. */
+static SDL_mutex *_pointerGameStateMutex = NULL;
+/** Tell the game logic thread to exit. */
+static bool _isGameLogicThreadStopped = false;
+/** Tell the game logic thread to count time from now, so the time spent in a menu is not simulated. */
+static bool _isGameLogicTimeReset = false;
+/** Wake the game logic thread up when it is waiting for the game to be restarted or stopped. */
+static SDL_cond *_pointerGameResumedCondition = NULL;
+
+/** The snapshot the last displayed frame was rendered from, or NULL if the game must be displayed again even if the snapshot did not change (a menu has been displayed on top of the game, for instance). */
+static SnapshotManager::Snapshot *_pointerDisplayedSnapshot = NULL;
+
 //-------------------------------------------------------------------------------------------------
 // Public variables
 //-------------------------------------------------------------------------------------------------
@@ -72,25 +98,30 @@ PlayerFightingEntity *pointerPlayer;
 //-------------------------------------------------------------------------------------------------
 // Private functions
 //-------------------------------------------------------------------------------------------------
-/** Free all lists content. */
+/** Release all level objects at once. */
 static void _clearAllLists()
 {
-	std::list<EnemySpawnerStaticEntity *>::iterator enemySpawnersListIterator;
-	for (enemySpawnersListIterator = LevelManager::enemySpawnersList.begin(); enemySpawnersListIterator != LevelManager::enemySpawnersList.end(); ++enemySpawnersListIterator) delete *enemySpawnersListIterator;
+	// Level objects destructors are not called, they would only remove the objects from the collision grids and from the level blocks, which are all reset when a level is loaded
 	LevelManager::enemySpawnersList.clear();
+	_enemiesList.clear();
+	_decidingEnemies.clear();
+	EffectManager::clearAllEffects();
+	CollisionManager::clear();
 	
-	std::list<BulletMovingEntity *>::iterator bulletsListIterator;
-	for (bulletsListIterator = _playerBulletsList.begin(); bulletsListIterator != _playerBulletsList.end(); ++bulletsListIterator) delete *bulletsListIterator;
-	_playerBulletsList.clear();
+	_playerBullets.clear();
+	_enemiesBullets.clear();
 	
-	for (bulletsListIterator = _enemiesBulletsList.begin(); bulletsListIterator != _enemiesBulletsList.end(); ++bulletsListIterator) delete *bulletsListIterator;
-	_enemiesBulletsList.clear();
+	// Nothing references the level objects anymore, release their memory
+	ObjectPoolBase::resetAll();
+	LevelArena::reset();
+}
 
-	std::list<EnemyFightingEntity *>::iterator enemiesListIterator;
-	for (enemiesListIterator = _enemiesList.begin(); enemiesListIterator != _enemiesList.end(); ++enemiesListIterator) delete *enemiesListIterator;
-	_enemiesList.clear();
-	
-	EffectManager::clearAllEffects();
+/** Make an enemy choose its action, this function is called by the worker threads.
+ * @param enemyIndex The enemy index in the deciding enemies array.
+ */
+static void _decideEnemy(int enemyIndex)
+{
+	_decidingEnemies[enemyIndex]->decide();
 }
 
 /** Automatically free allocated resources on program shutdown. */
@@ -105,9 +136,18 @@ static void _exitFreeResources()
 	
 	delete pointerPlayer;
 	
+	// All pooled objects have been destroyed, so the statistics are complete
+	ObjectPoolBase::logStatistics();
+	
+	SDL_DestroyCond(_pointerGameResumedCondition);
+	SDL_DestroyMutex(_pointerGameStateMutex);
+	WorkerPool::uninitialize();
+	SnapshotManager::uninitialize();
 	ControlManager::uninitialize();
 	AudioManager::uninitialize();
 	LevelManager::uninitialize();
+	HeadUpDisplay::uninitialize();
+	Menu::uninitialize();
 	TextureManager::uninitialize();
 	Renderer::uninitialize();
 	
@@ -230,9 +270,14 @@ static inline void _loadNextLevel()
 	
 	// Prepare to load next level
 	_currentLevelNumber++;
+	
+	// Decode the next level while this one is played, so it starts without delay
+	if (_currentLevelNumber < CONFIGURATION_LEVELS_COUNT) LevelManager::preloadLevel(_currentLevelNumber);
 }
 
-/** Update all game actors. */
+/** Update all game actors.
+ * @note TimeManager::tick() must have been called before, at the beginning of the game tick.
+ */
 static inline void _updateGameLogic()
 {
 	static unsigned int lastEnemySpawningTime = -CONFIGURATION_GAMEPLAY_TIME_BETWEEN_ENEMY_SPAWN; // Initialize to a negative value (gcc allows it) to spawn an enemy immediately when the game starts
@@ -252,88 +297,90 @@ static inline void _updateGameLogic()
 	}
 	
 	// Check if player bullets have hit a wall or an enemy
-	std::list<BulletMovingEntity *>::iterator bulletsListIterator = _playerBulletsList.begin();
-	std::list<EnemyFightingEntity *>::iterator enemiesListIterator;
-	std::list<EnemySpawnerStaticEntity *>::iterator enemySpawnersListIterator;
-	BulletMovingEntity *pointerPlayerBullet;
+	std::list<EnemyFightingEntity *, LevelArena::Allocator<EnemyFightingEntity *> >::iterator enemiesListIterator;
+	std::list<EnemySpawnerStaticEntity *, LevelArena::Allocator<EnemySpawnerStaticEntity *> >::iterator enemySpawnersListIterator;
 	EnemyFightingEntity *pointerEnemy;
 	EnemySpawnerStaticEntity *pointerEnemySpawner;
-	while (bulletsListIterator != _playerBulletsList.end())
+	SDL_Rect bulletPositionRectangle;
+	int i, bulletExplosionX, bulletExplosionY;
+	_playerBullets.update();
+	for (i = _playerBullets.getBulletsCount() - 1; i >= 0; i--) // Browse bullets from the end because removing a bullet moves the last one to its place
 	{
-		pointerPlayerBullet = *bulletsListIterator;
+		bulletExplosionX = _playerBullets.getX(i) + CONFIGURATION_BULLET_EXPLOSION_POSITION_OFFSET;
+		bulletExplosionY = _playerBullets.getY(i) + CONFIGURATION_BULLET_EXPLOSION_POSITION_OFFSET;
 		
 		// Remove the bullet if it hit a wall
-		if (pointerPlayerBullet->update() != 0)
+		if (_playerBullets.isDestroyed(i))
 		{
-			EffectManager::addEffect(pointerPlayerBullet->getX() + CONFIGURATION_BULLET_EXPLOSION_POSITION_OFFSET, pointerPlayerBullet->getY() + CONFIGURATION_BULLET_EXPLOSION_POSITION_OFFSET, EffectManager::EFFECT_ID_BULLET_EXPLOSION_NO_SOUND);
-			
-			delete pointerPlayerBullet;
-			bulletsListIterator = _playerBulletsList.erase(bulletsListIterator);
+			EffectManager::addEffect(bulletExplosionX, bulletExplosionY, EffectManager::EFFECT_ID_BULLET_EXPLOSION_NO_SOUND);
+			_playerBullets.removeBullet(i);
 			continue;
 		}
 		
-		// Check with all enemies for a collision
-		for (enemiesListIterator = _enemiesList.begin(); enemiesListIterator != _enemiesList.end(); ++enemiesListIterator)
+		// Find the first spawner the bullet went through, then stop the bullet on it so an enemy located behind the spawner can't be hit
+		_playerBullets.getCrossedRectangle(i, &bulletPositionRectangle);
+		pointerEnemySpawner = static_cast<EnemySpawnerStaticEntity *>(CollisionManager::getFirstCollidingEntity(CollisionManager::GRID_ID_ENEMY_SPAWNERS, &bulletPositionRectangle, _playerBullets.getDirection(i)));
+		if (pointerEnemySpawner != NULL)
 		{
-			pointerEnemy = *enemiesListIterator;
-			
-			// Did the bullet hit this enemy ?
-			if (SDL_HasIntersection(pointerPlayerBullet->getPositionRectangle(), pointerEnemy->getPositionRectangle()))
-			{
-				// Wound the enemy
-				pointerEnemy->modifyLife(pointerPlayerBullet->getDamageAmount());
-				LOG_DEBUG("Enemy hit.");
-				
-				int soundEmitterAngle = 0, soundEmitterDistance = 0, bulletCenterX = pointerPlayerBullet->getX() + CONFIGURATION_BULLET_EXPLOSION_POSITION_OFFSET, bulletCenterY = pointerPlayerBullet->getY() + CONFIGURATION_BULLET_EXPLOSION_POSITION_OFFSET;
-				AudioManager::computePositionFromCamera(bulletCenterX, bulletCenterY, &soundEmitterAngle, &soundEmitterDistance);
-				EffectManager::addEffect(bulletCenterX, bulletCenterY, EffectManager::EFFECT_ID_BULLET_EXPLOSION_ENEMY_HIT, soundEmitterAngle, soundEmitterDistance);
-				
-				// Remove the bullet
-				delete pointerPlayerBullet;
-				bulletsListIterator = _playerBulletsList.erase(bulletsListIterator);
-				
-				break;
-			}
+			_playerBullets.moveToHitPosition(i, pointerEnemySpawner->getPositionRectangle());
+			_playerBullets.getCrossedRectangle(i, &bulletPositionRectangle);
 		}
 		
-		// The bullet collided an enemy and was destroyed, check next bullet
-		if (enemiesListIterator != _enemiesList.end()) continue;
-		
-		// Check with all spawners for a collision
-		for (enemySpawnersListIterator = LevelManager::enemySpawnersList.begin(); enemySpawnersListIterator != LevelManager::enemySpawnersList.end(); ++enemySpawnersListIterator)
+		// Check with the enemies located on the bullet way for a collision
+		pointerEnemy = static_cast<EnemyFightingEntity *>(CollisionManager::getFirstCollidingEntity(CollisionManager::GRID_ID_ENEMIES, &bulletPositionRectangle, _playerBullets.getDirection(i)));
+		if (pointerEnemy != NULL)
 		{
-			pointerEnemySpawner = *enemySpawnersListIterator;
+			// Explode on the enemy side
+			_playerBullets.moveToHitPosition(i, pointerEnemy->getPositionRectangle());
+			bulletExplosionX = _playerBullets.getX(i) + CONFIGURATION_BULLET_EXPLOSION_POSITION_OFFSET;
+			bulletExplosionY = _playerBullets.getY(i) + CONFIGURATION_BULLET_EXPLOSION_POSITION_OFFSET;
 			
-			if (SDL_HasIntersection(pointerPlayerBullet->getPositionRectangle(), pointerEnemySpawner->getPositionRectangle()))
-			{
-				// Damage the enemy spawner
-				pointerEnemySpawner->modifyLife(pointerPlayerBullet->getDamageAmount());
-				LOG_DEBUG("Enemy spawner hit.");
-				
-				int soundEmitterAngle = 0, soundEmitterDistance = 0, bulletCenterX = pointerPlayerBullet->getX() + CONFIGURATION_BULLET_EXPLOSION_POSITION_OFFSET, bulletCenterY = pointerPlayerBullet->getY() + CONFIGURATION_BULLET_EXPLOSION_POSITION_OFFSET;
-				AudioManager::computePositionFromCamera(bulletCenterX, bulletCenterY, &soundEmitterAngle, &soundEmitterDistance);
-				EffectManager::addEffect(bulletCenterX, bulletCenterY, EffectManager::EFFECT_ID_BULLET_EXPLOSION_ENEMY_SPAWNER_HIT, soundEmitterAngle, soundEmitterDistance);
-				
-				// Remove the bullet
-				delete pointerPlayerBullet;
-				bulletsListIterator = _playerBulletsList.erase(bulletsListIterator);
-				
-				break;
-			}
+			// Wound the enemy
+			pointerEnemy->modifyLife(_playerBullets.getDamageAmount(i));
+			LOG_DEBUG("Enemy hit.");
+			
+			int soundEmitterAngle = 0, soundEmitterDistance = 0;
+			AudioManager::computePositionFromCamera(bulletExplosionX, bulletExplosionY, &soundEmitterAngle, &soundEmitterDistance);
+			EffectManager::addEffect(bulletExplosionX, bulletExplosionY, EffectManager::EFFECT_ID_BULLET_EXPLOSION_ENEMY_HIT, soundEmitterAngle, soundEmitterDistance);
+			
+			// Remove the bullet
+			_playerBullets.removeBullet(i);
+			continue;
 		}
 		
-		// The bullet collided an enemy spawner and was destroyed, check next bullet
-		if (enemySpawnersListIterator != LevelManager::enemySpawnersList.end()) continue;
-		
-		// The bullet is still alive, check next one
-		++bulletsListIterator;
+		// The bullet hit a spawner
+		if (pointerEnemySpawner != NULL)
+		{
+			bulletExplosionX = _playerBullets.getX(i) + CONFIGURATION_BULLET_EXPLOSION_POSITION_OFFSET;
+			bulletExplosionY = _playerBullets.getY(i) + CONFIGURATION_BULLET_EXPLOSION_POSITION_OFFSET;
+			
+			// Damage the enemy spawner
+			pointerEnemySpawner->modifyLife(_playerBullets.getDamageAmount(i));
+			LOG_DEBUG("Enemy spawner hit.");
+			
+			int soundEmitterAngle = 0, soundEmitterDistance = 0;
+			AudioManager::computePositionFromCamera(bulletExplosionX, bulletExplosionY, &soundEmitterAngle, &soundEmitterDistance);
+			EffectManager::addEffect(bulletExplosionX, bulletExplosionY, EffectManager::EFFECT_ID_BULLET_EXPLOSION_ENEMY_SPAWNER_HIT, soundEmitterAngle, soundEmitterDistance);
+			
+			// Remove the bullet
+			_playerBullets.removeBullet(i);
+		}
 	}
 	
 	// Update enemies artificial intelligence
-	BulletMovingEntity *pointerBullet;
 	int result;
 	int previousEnemiesAmount = _enemiesList.size();
 	SDL_Rect *pointerPositionRectangle;
+	
+	// Find the ways to the player once for all enemies
+	pointerPositionRectangle = pointerPlayer->getPositionRectangle();
+	LevelManager::updatePlayerPaths(pointerPositionRectangle->x + (pointerPositionRectangle->w / 2), pointerPositionRectangle->y + (pointerPositionRectangle->h / 2));
+	
+	// All enemies choose their action at the same time, they only read the level and the player, which do not change until all enemies have decided
+	_decidingEnemies.assign(_enemiesList.begin(), _enemiesList.end());
+	WorkerPool::runParallelLoop(_decideEnemy, _decidingEnemies.size());
+	
+	// Carry out the actions one enemy after the other, always in the list order, so when several enemies want to enter the same block the same enemy wins each time the game is played
 	enemiesListIterator = _enemiesList.begin();
 	while (enemiesListIterator != _enemiesList.end())
 	{
@@ -356,9 +403,8 @@ static inline void _updateGameLogic()
 		// The enemy wants to shoot
 		else if (result == 2)
 		{
-			// Is the enemy allowed to fire ?
-			pointerBullet = pointerEnemy->shoot();
-			if (pointerBullet != NULL) _enemiesBulletsList.push_front(pointerBullet);
+			// Fire only if the enemy is allowed to
+			pointerEnemy->shoot(&_enemiesBullets);
 		}
 		
 		// Enemy is still alive, check next one
@@ -366,34 +412,38 @@ static inline void _updateGameLogic()
 	}
 	
 	// Check if enemies bullets have hit the player (update enemies bullets after enemies, so if they shot a new bullet is it updated too, in the same way it's done for the player. Thus, it is possible to adjust bullet spawning coordinate offsets in the same way for player and enemies)
-	BulletMovingEntity *pointerEnemyBullet;
-	bulletsListIterator = _enemiesBulletsList.begin();
+	_enemiesBullets.update();
 	pointerPositionRectangle = pointerPlayer->getPositionRectangle();
-	while (bulletsListIterator != _enemiesBulletsList.end())
+	for (i = _enemiesBullets.getBulletsCount() - 1; i >= 0; i--)
 	{
-		pointerEnemyBullet = *bulletsListIterator;
+		bulletExplosionX = _enemiesBullets.getX(i) + CONFIGURATION_BULLET_EXPLOSION_POSITION_OFFSET;
+		bulletExplosionY = _enemiesBullets.getY(i) + CONFIGURATION_BULLET_EXPLOSION_POSITION_OFFSET;
 		
 		// Remove the bullet if it hit a wall
-		if (pointerEnemyBullet->update() != 0)
+		if (_enemiesBullets.isDestroyed(i))
 		{
-			EffectManager::addEffect(pointerEnemyBullet->getX() + CONFIGURATION_BULLET_EXPLOSION_POSITION_OFFSET, pointerEnemyBullet->getY() + CONFIGURATION_BULLET_EXPLOSION_POSITION_OFFSET, EffectManager::EFFECT_ID_BULLET_EXPLOSION_NO_SOUND);
-			
-			delete pointerEnemyBullet;
-			bulletsListIterator = _playerBulletsList.erase(bulletsListIterator);
+			EffectManager::addEffect(bulletExplosionX, bulletExplosionY, EffectManager::EFFECT_ID_BULLET_EXPLOSION_NO_SOUND);
+			_enemiesBullets.removeBullet(i);
 			continue;
 		}
 		
-		if (SDL_HasIntersection(pointerPositionRectangle, pointerEnemyBullet->getPositionRectangle()))
+		// The bullet may have gone through the player during the last update if it is fast
+		_enemiesBullets.getCrossedRectangle(i, &bulletPositionRectangle);
+		if (SDL_HasIntersection(pointerPositionRectangle, &bulletPositionRectangle))
 		{
+			// Explode on the player side
+			_enemiesBullets.moveToHitPosition(i, pointerPositionRectangle);
+			bulletExplosionX = _enemiesBullets.getX(i) + CONFIGURATION_BULLET_EXPLOSION_POSITION_OFFSET;
+			bulletExplosionY = _enemiesBullets.getY(i) + CONFIGURATION_BULLET_EXPLOSION_POSITION_OFFSET;
+			
 			// Wound the player
-			_isPlayerHit = pointerPlayer->modifyLife(pointerEnemyBullet->getDamageAmount());
+			_isPlayerHit = pointerPlayer->modifyLife(_enemiesBullets.getDamageAmount(i));
 			if (_isPlayerHit) LOG_DEBUG("Player hit.");
 			
-			EffectManager::addEffect(pointerEnemyBullet->getX() + CONFIGURATION_BULLET_EXPLOSION_POSITION_OFFSET, pointerEnemyBullet->getY() + CONFIGURATION_BULLET_EXPLOSION_POSITION_OFFSET, EffectManager::EFFECT_ID_BULLET_EXPLOSION_NO_SOUND);
+			EffectManager::addEffect(bulletExplosionX, bulletExplosionY, EffectManager::EFFECT_ID_BULLET_EXPLOSION_NO_SOUND);
 			
 			// Remove the bullet
-			delete pointerEnemyBullet;
-			bulletsListIterator = _playerBulletsList.erase(bulletsListIterator);
+			_enemiesBullets.removeBullet(i);
 			
 			// Instantly stop game updating
 			if (pointerPlayer->isDead())
@@ -403,20 +453,16 @@ static inline void _updateGameLogic()
 				LOG_DEBUG("Player died.");
 				return;
 			}
-			continue;
 		}
-		
-		// Bullet is still alive, check next one
-		++bulletsListIterator;
 	}
 	
 	// Update enemy spawners at the end, to avoid new enemies being spawned in the middle of the update function
 	int blockContent, isEnemySpawned = 0;
 	enemySpawnersListIterator = LevelManager::enemySpawnersList.begin();
 	// Should enemies be spawned ?
-	if (SDL_GetTicks() - lastEnemySpawningTime >= CONFIGURATION_GAMEPLAY_TIME_BETWEEN_ENEMY_SPAWN)
+	if (TimeManager::getTicks() - lastEnemySpawningTime >= CONFIGURATION_GAMEPLAY_TIME_BETWEEN_ENEMY_SPAWN)
 	{
-		lastEnemySpawningTime = SDL_GetTicks();
+		lastEnemySpawningTime = TimeManager::getTicks();
 		isEnemySpawned = 1;
 	}
 	while (enemySpawnersListIterator !=  LevelManager::enemySpawnersList.end())
@@ -458,14 +504,48 @@ static inline void _updateGameLogic()
 	if (currentEnemiesAmount != previousEnemiesAmount) HeadUpDisplay::setEnemiesAmount(currentEnemiesAmount);
 }
 
-/** Display and keep up to date interface strings. */
-static inline void _renderInterface()
+/** Move the player and make it shoot according to the pressed keys. */
+static inline void _handlePlayerControls()
+{
+	// React to player key press without depending of keyboard key repetition rate
+	// Handle both vertical and horizontal direction movement
+	if ((ControlManager::isKeyPressed(ControlManager::KEY_ID_GO_UP) || ControlManager::isKeyPressed(ControlManager::KEY_ID_GO_DOWN)) && (ControlManager::isKeyPressed(ControlManager::KEY_ID_GO_LEFT) || ControlManager::isKeyPressed(ControlManager::KEY_ID_GO_RIGHT)))
+	{
+		// Keep trace of the last direction the player took to favor it, when this key will be released the previous direction will be favored
+		if (ControlManager::isLastPressedDirectionKeyOnVerticalAxis())
+		{
+			if (ControlManager::isKeyPressed(ControlManager::KEY_ID_GO_UP)) pointerPlayer->moveToUp();
+			else pointerPlayer->moveToDown();
+		}
+		else
+		{
+			if (ControlManager::isKeyPressed(ControlManager::KEY_ID_GO_LEFT)) pointerPlayer->moveToLeft();
+			else pointerPlayer->moveToRight();
+		}
+	}
+	// Handle a single key press
+	else
+	{
+		if (ControlManager::isKeyPressed(ControlManager::KEY_ID_GO_UP)) pointerPlayer->moveToUp();
+		else if (ControlManager::isKeyPressed(ControlManager::KEY_ID_GO_DOWN)) pointerPlayer->moveToDown();
+		else if (ControlManager::isKeyPressed(ControlManager::KEY_ID_GO_LEFT)) pointerPlayer->moveToLeft();
+		else if (ControlManager::isKeyPressed(ControlManager::KEY_ID_GO_RIGHT)) pointerPlayer->moveToRight();
+	}
+	
+	// Fire a bullet (the player may not be allowed to shoot)
+	if (ControlManager::isKeyPressed(ControlManager::KEY_ID_PRIMARY_SHOOT)) pointerPlayer->shoot(&_playerBullets);
+	// Fire a mortar shell (bullet and mortar shell can be shot in the same time)
+	if (ControlManager::isKeyPressed(ControlManager::KEY_ID_SECONDARY_SHOOT)) pointerPlayer->shootSecondaryFire(&_playerBullets);
+}
+
+/** Light the compass arrows pointing to the enemy spawners. */
+static inline void _updateCompass()
 {
 	// Turn off all compass arrows, so only the appropriate ones will be lighted
 	for (int i = 0; i < HeadUpDisplay::COMPASS_ARROW_IDS_COUNT; i++) HeadUpDisplay::setCompassArrowState(static_cast<HeadUpDisplay::CompassArrowId>(i), false);
 	
 	// Detect enemy spawners positions against player to light the corresponding compass arrows
-	std::list<EnemySpawnerStaticEntity *>::iterator enemySpawnersListIterator;
+	std::list<EnemySpawnerStaticEntity *, LevelArena::Allocator<EnemySpawnerStaticEntity *> >::iterator enemySpawnersListIterator;
 	EnemySpawnerStaticEntity *pointerSpawner;
 	int playerBlockX = pointerPlayer->getX() / CONFIGURATION_LEVEL_BLOCK_SIZE;
 	int playerBlockY = pointerPlayer->getY() / CONFIGURATION_LEVEL_BLOCK_SIZE;
@@ -485,54 +565,390 @@ static inline void _renderInterface()
 		if (spawnerBlockX < playerBlockX) HeadUpDisplay::setCompassArrowState(HeadUpDisplay::COMPASS_ARROW_ID_LEFT, true);
 		else if (spawnerBlockX > playerBlockX) HeadUpDisplay::setCompassArrowState(HeadUpDisplay::COMPASS_ARROW_ID_RIGHT, true);
 	}
+}
+
+/** Record everything to display and publish it to the main thread.
+ * @param tickTime The performance counter value when the last game tick was due.
+ */
+static inline void _recordSnapshot(Uint64 tickTime)
+{
+	SnapshotManager::Snapshot *pointerSnapshot = SnapshotManager::beginSnapshot();
 	
-	HeadUpDisplay::render();
+	// Nothing moves anymore when the game is paused
+	pointerSnapshot->tickTime = tickTime;
+	pointerSnapshot->isInterpolated = !_isGamePaused;
 	
-	// Display a centered message if needed
-	if (_isPlayerDead) Renderer::renderCenteredTexture(_pointerGameLostInterfaceStringTexture);
-	else if (_isGameFinished) Renderer::renderCenteredTexture(_pointerGameWonInterfaceStringTexture);
+	// Compute rendering top left coordinates (follow the player position, so the camera moves as smoothly as the player)
+	pointerSnapshot->cameraPreviousX = pointerPlayer->getPreviousX() - _cameraOffsetX;
+	pointerSnapshot->cameraPreviousY = pointerPlayer->getPreviousY() - _cameraOffsetY;
+	pointerSnapshot->cameraX = pointerPlayer->getX() - _cameraOffsetX;
+	pointerSnapshot->cameraY = pointerPlayer->getY() - _cameraOffsetY;
+	
+	// Record enemy spawners
+	SnapshotManager::setLayer(Renderer::LAYER_ID_ENEMY_SPAWNERS);
+	std::list<EnemySpawnerStaticEntity *, LevelArena::Allocator<EnemySpawnerStaticEntity *> >::iterator enemySpawnersListIterator;
+	for (enemySpawnersListIterator = LevelManager::enemySpawnersList.begin(); enemySpawnersListIterator != LevelManager::enemySpawnersList.end(); ++enemySpawnersListIterator) (*enemySpawnersListIterator)->addToSnapshot();
+	
+	// Record enemies
+	SnapshotManager::setLayer(Renderer::LAYER_ID_ENEMIES);
+	std::list<EnemyFightingEntity *, LevelArena::Allocator<EnemyFightingEntity *> >::iterator enemiesListIterator;
+	for (enemiesListIterator = _enemiesList.begin(); enemiesListIterator != _enemiesList.end(); ++enemiesListIterator) (*enemiesListIterator)->addToSnapshot();
+	
+	// Display bullets after enemies, so when multiple enemies fire on themselves bullets are visible on top of enemies
+	SnapshotManager::setLayer(Renderer::LAYER_ID_BULLETS);
+	_playerBullets.addToSnapshot();
+	_enemiesBullets.addToSnapshot();
+	
+	// Display the player after the other entities, so it is always rendered on top on everything else and can always be visible
+	SnapshotManager::setLayer(Renderer::LAYER_ID_PLAYER);
+	pointerPlayer->addToSnapshot();
+	
+	// Display special effects at the end, so they can recover everything
+	SnapshotManager::setLayer(Renderer::LAYER_ID_EFFECTS);
+	EffectManager::addToSnapshot();
+	
+	// Record the interface values
+	_updateCompass();
+	HeadUpDisplay::getState(&pointerSnapshot->headUpDisplayState);
+	LevelManager::getSceneUpdate(&pointerSnapshot->sceneUpdate);
+	pointerSnapshot->isPlayerHit = _isPlayerHit;
+	_isPlayerHit = false;
+	pointerSnapshot->isPlayerDead = _isPlayerDead;
+	pointerSnapshot->isGameFinished = _isGameFinished;
+	
+	SnapshotManager::publishSnapshot();
 }
 
-/** Display everything to the screen. */
-static inline void _renderGame()
+/** Update the game logic at a fixed rate and publish a snapshot after each update, until the main thread stops the game.
+ * @return Always 0.
+ */
+static int _gameLogicThread(void *)
 {
-	// Compute rendering top left coordinates
-	int sceneX = pointerPlayer->getX() - _cameraOffsetX;
-	int sceneY = pointerPlayer->getY() - _cameraOffsetY;
+	Uint64 nextTickTime, tickTime = 0, currentTime;
+	bool isGameUpdated;
+	
+	nextTickTime = SDL_GetPerformanceCounter();
+	while (1)
+	{
+		SDL_LockMutex(_pointerGameStateMutex);
+		
+		if (_isGameLogicThreadStopped)
+		{
+			SDL_UnlockMutex(_pointerGameStateMutex);
+			break;
+		}
+		
+		// Nothing is simulated anymore when the player died or won, so sleep until the game is restarted or stopped
+		if (_isGamePaused)
+		{
+			SDL_CondWait(_pointerGameResumedCondition, _pointerGameStateMutex);
+			SDL_UnlockMutex(_pointerGameStateMutex);
+			continue;
+		}
+		
+		// Do not simulate the time spent in the menus
+		currentTime = SDL_GetPerformanceCounter();
+		if (_isGameLogicTimeReset)
+		{
+			nextTickTime = currentTime;
+			_isGameLogicTimeReset = false;
+		}
+		// Do not try to catch up too much late time, or a slow computer would spend all its time updating the game logic
+		else if ((currentTime > nextTickTime) && (currentTime - nextTickTime > _tickPeriod * CONFIGURATION_GAMEPLAY_MAXIMUM_TICKS_PER_FRAME)) nextTickTime = currentTime - (_tickPeriod * CONFIGURATION_GAMEPLAY_MAXIMUM_TICKS_PER_FRAME);
+		
+		// Update the game logic as many times as needed to consume the elapsed time
+		isGameUpdated = false;
+		while (nextTickTime <= currentTime)
+		{
+			tickTime = nextTickTime;
+			nextTickTime += _tickPeriod;
+			
+			// Do not update the game anymore if the player died
+			if (_isGamePaused) continue;
+			
+			TimeManager::tick();
+			_handlePlayerControls();
+			_updateGameLogic();
+			isGameUpdated = true;
+		}
+		
+		// The last published snapshot is still valid if nothing changed
+		if (isGameUpdated) _recordSnapshot(tickTime);
+		
+		SDL_UnlockMutex(_pointerGameStateMutex);
+		
+		// Wait for the next game tick
+		currentTime = SDL_GetPerformanceCounter();
+		if (nextTickTime > currentTime) SDL_Delay(static_cast<Uint32>(((nextTickTime - currentTime) * 1000) / SDL_GetPerformanceFrequency()));
+	}
+	
+	LOG_DEBUG("Game logic thread exited.");
+	return 0;
+}
+
+/** Display a game snapshot to the screen.
+ * @param pointerSnapshot The snapshot to display.
+ */
+static inline void _renderGame(SnapshotManager::Snapshot *pointerSnapshot)
+{
+	float interpolationFactor;
+	Uint64 currentTime;
+	int layerId, sceneX, sceneY;
+	size_t i;
+	std::vector<SnapshotManager::Sprite> *pointerSprites;
+	SnapshotManager::Sprite *pointerSprite;
+	SnapshotManager::DebugRectangle *pointerDebugRectangle;
+	SDL_Rect positionRectangle;
+	
+	// Render moving entities between their last two positions according to the elapsed part of the next tick (there is nothing to interpolate when the game is not updated)
+	currentTime = SDL_GetPerformanceCounter();
+	if (!pointerSnapshot->isInterpolated || (currentTime >= pointerSnapshot->tickTime + _tickPeriod)) interpolationFactor = 1;
+	else if (currentTime <= pointerSnapshot->tickTime) interpolationFactor = 0;
+	else interpolationFactor = static_cast<float>(currentTime - pointerSnapshot->tickTime) / _tickPeriod;
+	
+	// Compute rendering top left coordinates (follow the interpolated player position, so the camera moves as smoothly as the player)
+	sceneX = pointerSnapshot->cameraPreviousX + static_cast<int>((pointerSnapshot->cameraX - pointerSnapshot->cameraPreviousX) * interpolationFactor);
+	sceneY = pointerSnapshot->cameraPreviousY + static_cast<int>((pointerSnapshot->cameraY - pointerSnapshot->cameraPreviousY) * interpolationFactor);
 	Renderer::displayX = sceneX;
 	Renderer::displayY = sceneY;
 	
-	// Render the level walls and static objects (ammunition, medipacks, ...)
+	// Render the level walls and static objects (ammunition, medipacks, ...), the scene changes are applied only the first time the snapshot is displayed
+	LevelManager::applySceneUpdate(&pointerSnapshot->sceneUpdate);
+	Renderer::setLayer(Renderer::LAYER_ID_SCENE);
 	LevelManager::renderScene(sceneX, sceneY);
 	
-	// Display enemy spawners
-	std::list<EnemySpawnerStaticEntity *>::iterator enemySpawnersListIterator;
-	for (enemySpawnersListIterator = LevelManager::enemySpawnersList.begin(); enemySpawnersListIterator != LevelManager::enemySpawnersList.end(); ++enemySpawnersListIterator) (*enemySpawnersListIterator)->render();
+	// Display all entities
+	for (layerId = 0; layerId < Renderer::LAYER_IDS_COUNT; layerId++)
+	{
+		pointerSprites = &pointerSnapshot->sprites[layerId];
+		if (pointerSprites->empty()) continue;
+		
+		Renderer::setLayer(static_cast<Renderer::LayerId>(layerId));
+		for (i = 0; i < pointerSprites->size(); i++)
+		{
+			pointerSprite = &(*pointerSprites)[i];
+			positionRectangle.x = pointerSprite->previousX + static_cast<int>((pointerSprite->x - pointerSprite->previousX) * interpolationFactor) - sceneX;
+			positionRectangle.y = pointerSprite->previousY + static_cast<int>((pointerSprite->y - pointerSprite->previousY) * interpolationFactor) - sceneY;
+			positionRectangle.w = pointerSprite->sourceRectangle.w;
+			positionRectangle.h = pointerSprite->sourceRectangle.h;
+			Renderer::renderBatchedTexture(pointerSprite->pointerSDLTexture, &pointerSprite->sourceRectangle, &positionRectangle);
+		}
+	}
 	
-	// Display enemies
-	std::list<EnemyFightingEntity *>::iterator enemiesListIterator;
-	for (enemiesListIterator = _enemiesList.begin(); enemiesListIterator != _enemiesList.end(); ++enemiesListIterator) (*enemiesListIterator)->render();
+	// Display the collision rectangles in debug mode
+	if (!pointerSnapshot->debugRectangles.empty())
+	{
+		// Rectangles are not batched, so render the queued textures first
+		Renderer::flushBatch();
+		
+		for (i = 0; i < pointerSnapshot->debugRectangles.size(); i++)
+		{
+			pointerDebugRectangle = &pointerSnapshot->debugRectangles[i];
+			SDL_SetRenderDrawColor(Renderer::pointerRenderer, pointerDebugRectangle->color.r, pointerDebugRectangle->color.g, pointerDebugRectangle->color.b, pointerDebugRectangle->color.a);
+			positionRectangle = pointerDebugRectangle->rectangle;
+			positionRectangle.x -= sceneX;
+			positionRectangle.y -= sceneY;
+			SDL_RenderDrawRect(Renderer::pointerRenderer, &positionRectangle);
+		}
+		
+		// Restore background color
+		SDL_SetRenderDrawColor(Renderer::pointerRenderer, 0, 0, 0, 255);
+	}
 	
-	// Display bullets after enemies, so when multiple enemies fire on themselves bullets are visible on top of enemies
-	std::list<BulletMovingEntity *>::iterator bulletsListIterator;
-	for (bulletsListIterator = _playerBulletsList.begin(); bulletsListIterator != _playerBulletsList.end(); ++bulletsListIterator) (*bulletsListIterator)->render();
-	for (bulletsListIterator = _enemiesBulletsList.begin(); bulletsListIterator != _enemiesBulletsList.end(); ++bulletsListIterator) (*bulletsListIterator)->render();
+	// Display the red overlay only once
+	if (pointerSnapshot->isPlayerHit)
+	{
+		Renderer::setLayer(Renderer::LAYER_ID_OVERLAY);
+		Renderer::renderBatchedTexture(_pointerPlayerHitOverlayTexture->getSDLTexture(), _pointerPlayerHitOverlayTexture->getSourceRectangle(), NULL);
+		pointerSnapshot->isPlayerHit = false;
+	}
 	
-	// Display the player now, so it is always rendered on top on everything else and can always be visible
-	pointerPlayer->render();
+	// Display HUD
+	Renderer::setLayer(Renderer::LAYER_ID_INTERFACE);
+	HeadUpDisplay::render(&pointerSnapshot->headUpDisplayState);
 	
-	// Display special effects at the end, so they can recover everything
-	EffectManager::render();
+	// Display a centered message if needed
+	if (pointerSnapshot->isPlayerDead) Renderer::renderCenteredTexture(_pointerGameLostInterfaceStringTexture);
+	else if (pointerSnapshot->isGameFinished) Renderer::renderCenteredTexture(_pointerGameWonInterfaceStringTexture);
+}
+
+/** Handle all pending events and display the pause menu if it is requested.
+ * @return 0 if the game must continue,
+ * @return 1 if the game must exit.
+ * @note The game state mutex must be locked by the caller, so the game logic is not updated while the controls or the game state are modified.
+ */
+static int _handleEvents()
+{
+	SDL_Event event;
+	int levelToLoadNumber, maximumLifePointsAmount;
+	static const char *pointerStringsPauseMenuItems[] =
+	{
+		"Continue",
+		"Restart level",
+		"Quit"
+	};
+	static const char *pointerStringsVictoryMenuItems[] =
+	{
+		"Relish your victory",
+		"Quit"
+	};
+	
+	// Handle all relevant events
+	while (SDL_PollEvent(&event))
+	{
+		switch (event.type)
+		{
+			case SDL_QUIT:
+				return 1;
+				
+			case SDL_CONTROLLERBUTTONUP:
+			case SDL_CONTROLLERBUTTONDOWN:
+			case SDL_CONTROLLERAXISMOTION:
+				ControlManager::handleGameControllerEvent(&event);
+				break;
+				
+			case SDL_KEYUP:
+			case SDL_KEYDOWN:
+				ControlManager::handleKeyboardEvent(&event);
+				break;
+				
+			// The window content may have been lost (the window was hidden or resized, or the renderer lost its textures)
+			case SDL_WINDOWEVENT:
+			case SDL_RENDER_TARGETS_RESET:
+			case SDL_RENDER_DEVICE_RESET:
+				_pointerDisplayedSnapshot = NULL;
+				break;
+		}
+	}
 	
-	// Display the red overlay
-	if (_isPlayerHit)
+	// Pause or continue the game
+	if (ControlManager::isKeyPressed(ControlManager::KEY_ID_PAUSE_GAME))
 	{
-		SDL_RenderCopy(Renderer::pointerRenderer, _pointerPlayerHitOverlayTexture->getSDLTexture(), NULL, NULL);
-		_isPlayerHit = false;
+		// Stop playing music while the game is paused (in case the game must be quickly hidden to an incoming person)
+		LOG_DEBUG("Game paused.");
+		AudioManager::pauseMusic(1);
+		
+		// Player won, display a specific menu
+		if (_isGameFinished)
+		{
+			if (Menu::display("Victory !", pointerStringsVictoryMenuItems, 2) == 1) return 1;
+		}
+		// Normal pause menu
+		else
+		{
+			switch (Menu::display("Pause", pointerStringsPauseMenuItems, 3))
+			{
+				// Player has selected "Continue"
+				case 0:
+					break;
+				
+				// Player has selected "Restart level"
+				case 1:
+					// Stop currently playing sounds
+					AudioManager::stopAllSounds();
+					
+					// Free all entities
+					_clearAllLists();
+					
+					// Choose level number to load (_loadNextLevel() automatically increments _currentLevelNumber)
+					if (_currentLevelNumber == 0) levelToLoadNumber = 0;
+					else levelToLoadNumber = _currentLevelNumber - 1;
+					
+					// Try to load the level
+					if (LevelManager::loadLevel(levelToLoadNumber) != 0)
+					{
+						LOG_ERROR("Failed to reload level %d.", levelToLoadNumber);
+						exit(-1);
+					}
+					
+					// The preloaded next level has been overwritten when reloading the level
+					if (_currentLevelNumber < CONFIGURATION_LEVELS_COUNT) LevelManager::preloadLevel(_currentLevelNumber);
+					
+					// Restore player life and ammunition count as they were at the level start
+					maximumLifePointsAmount = SavegameManager::getSavegameItem(SavegameManager::SAVEGAME_ITEM_ID_PLAYER_MAXIMUM_LIFE_POINTS);
+					pointerPlayer->setLifePointsAmount(maximumLifePointsAmount);
+					pointerPlayer->setMaximumLifePointsAmount(maximumLifePointsAmount);
+					pointerPlayer->setAmmunitionAmount(SavegameManager::getSavegameItem(SavegameManager::SAVEGAME_ITEM_ID_PLAYER_AMMUNITION));
+					
+					// Allow the game to restart if the player is dead
+					if (_isPlayerDead)
+					{
+						_isPlayerDead = false;
+						_isGamePaused = false;
+					}
+					break;
+				
+				default:
+					return 1;
+			}
+		}
+		
+		LOG_DEBUG("Game continuing.");
+		AudioManager::pauseMusic(0);
+		
+		// Do not simulate the time spent in the menu
+		_isGameLogicTimeReset = true;
+		
+		// The game may have been restarted, wake the game logic thread up if it was waiting for this
+		SDL_CondSignal(_pointerGameResumedCondition);
+		
+		// The menu covered the game
+		_pointerDisplayedSnapshot = NULL;
 	}
 	
-	// Display HUD
-	_renderInterface();
+	return 0;
+}
+
+/** Update the game logic as fast as possible without displaying anything, then print how many game ticks were simulated per second. The player does not move but keeps shooting, and it is resurrected each time it dies so the simulation is never stopped.
+ * @param firstLevelNumber The first level to simulate.
+ * @param lastLevelNumber The last level to simulate (this level is simulated too).
+ */
+static void _runHeadlessSimulation(int firstLevelNumber, int lastLevelNumber)
+{
+	int levelNumber, ticksCount, playerDeathsCount;
+	Uint64 startingTime;
+	double elapsedSeconds;
+	
+	for (levelNumber = firstLevelNumber; levelNumber <= lastLevelNumber; levelNumber++)
+	{
+		// Do not use _loadNextLevel() to keep the player savegame untouched
+		_clearAllLists();
+		if (LevelManager::loadLevel(levelNumber) != 0)
+		{
+			LOG_ERROR("Failed to load level %d.", levelNumber);
+			exit(-1);
+		}
+		_currentLevelNumber = levelNumber + 1; // Level number is incremented in the same way than _loadNextLevel() does
+		if (levelNumber < lastLevelNumber) LevelManager::preloadLevel(levelNumber + 1);
+		pointerPlayer->setLifePointsAmount(pointerPlayer->getMaximumLifePointsAmount());
+		pointerPlayer->setAmmunitionAmount(CONFIGURATION_GAMEPLAY_PLAYER_DEFAULT_AMMUNITION_AMOUNT);
+		playerDeathsCount = 0;
+		
+		startingTime = SDL_GetPerformanceCounter();
+		for (ticksCount = 0; ticksCount < CONFIGURATION_HEADLESS_TICKS_PER_LEVEL; ticksCount++)
+		{
+			TimeManager::tick();
+			
+			// Keep shooting to have bullets to simulate, with unlimited ammunition
+			pointerPlayer->shoot(&_playerBullets);
+			if (pointerPlayer->getAmmunitionAmount() == 0) pointerPlayer->setAmmunitionAmount(CONFIGURATION_GAMEPLAY_PLAYER_DEFAULT_AMMUNITION_AMOUNT);
+			
+			_updateGameLogic();
+			
+			// Resurrect the player
+			if (_isPlayerDead)
+			{
+				pointerPlayer->setLifePointsAmount(pointerPlayer->getMaximumLifePointsAmount());
+				_isPlayerDead = false;
+				_isGamePaused = false;
+				playerDeathsCount++;
+			}
+		}
+		elapsedSeconds = static_cast<double>(SDL_GetPerformanceCounter() - startingTime) / SDL_GetPerformanceFrequency();
+		
+		printf("Level %d : %d ticks simulated in %.3f s (%.0f ticks per second), %d enemies alive, %d player deaths.\n", levelNumber, ticksCount, elapsedSeconds, ticksCount / elapsedSeconds, static_cast<int>(_enemiesList.size()), playerDeathsCount);
+		LOG_INFORMATION("Level %d : %d ticks simulated in %.3f s (%.0f ticks per second), %d enemies alive, %d player deaths.", levelNumber, ticksCount, elapsedSeconds, ticksCount / elapsedSeconds, static_cast<int>(_enemiesList.size()), playerDeathsCount);
+	}
 }
 
 //-------------------------------------------------------------------------------------------------
@@ -540,13 +956,12 @@ static inline void _renderGame()
 //-------------------------------------------------------------------------------------------------
 int main(int argc, char *argv[])
 {
-	SDL_Event event;
 	unsigned int frameRateStartingTime = 0;
-	bool isFullScreenEnabled = true, isFramesPerSecondDisplayingEnabled = false;
-	int levelToLoadNumber, i, framesCount = 0;
-	BulletMovingEntity *pointerBullet;
-	SDL_Texture *pointerFramesPerSecondSdlTexture = NULL;
-	char stringFramesPerSecond[16];
+	bool isFullScreenEnabled = true, isFramesPerSecondDisplayingEnabled = false, isHeadlessModeEnabled = false;
+	int i, framesCount = 0, headlessLevelNumber = -1, isGameExited;
+	unsigned int sdlSubsystemsFlags;
+	SnapshotManager::Snapshot *pointerSnapshot;
+	char stringFramesPerSecond[16] = "--";
 	static const char *pointerStringsMainMenuWithSavegameItems[] =
 	{
 		"Continue game",
@@ -560,17 +975,6 @@ int main(int argc, char *argv[])
 		"Controls",
 		"Quit"
 	};
-	static const char *pointerStringsPauseMenuItems[] =
-	{
-		"Continue",
-		"Restart level",
-		"Quit"
-	};
-	static const char *pointerStringsVictoryMenuItems[] =
-	{
-		"Relish your victory",
-		"Quit"
-	};
 	
 	// Check parameters
 	if (argc > 1)
@@ -582,14 +986,28 @@ int main(int argc, char *argv[])
 			if (strcmp("--fps", argv[i]) == 0) isFramesPerSecondDisplayingEnabled = true;
 			// Is full screen mode requested ?
 			else if (strcmp("--windowed", argv[i]) == 0) isFullScreenEnabled = false;
+			// Is the simulation speed measurement requested ?
+			else if (strcmp("--headless", argv[i]) == 0) isHeadlessModeEnabled = true;
+			// Is a specific level requested for the simulation speed measurement ?
+			else if (strncmp("--level=", argv[i], 8) == 0)
+			{
+				headlessLevelNumber = atoi(&argv[i][8]);
+				if (headlessLevelNumber < 0)
+				{
+					printf("Invalid level number : \"%s\".\n", &argv[i][8]);
+					return -1;
+				}
+			}
 			// Display help only if requested, because macOS may add custom parameters like -psn_0_340051
 			else if ((strcmp("--help", argv[i]) == 0) || (strcmp("-h", argv[i]) == 0))
 			{
 				printf("Usage : %s [option].\n"
 					"Available options :\n"
-					"  --fps      : display frames per second count.\n"
-					"  --help,-h  : display this help and exit.\n"
-					"  --windowed : play game in windowed screen mode.\n"
+					"  --fps            : display frames per second count.\n"
+					"  --headless       : simulate all levels as fast as possible without display nor sound, then print the simulation speed.\n"
+					"  --help,-h        : display this help and exit.\n"
+					"  --level=<number> : simulate only this level in headless mode (the level files must be present in the Levels directory).\n"
+					"  --windowed       : play game in windowed screen mode.\n"
 					"All other parameters are ignored.\n", argv[0]);
 				return 0;
 			}
@@ -602,20 +1020,36 @@ int main(int argc, char *argv[])
 	if (FileManager::initialize() != 0) return -1; // Must be initialized before the subsystems that use it
 	if (Log::initialize() != 0) return -1;
 	
-	// Initialize the needed SDL subsystems
-	if (SDL_Init(SDL_INIT_TIMER | SDL_INIT_VIDEO | SDL_INIT_EVENTS | SDL_INIT_GAMECONTROLLER | SDL_INIT_AUDIO) != 0)
+	// Initialize the needed SDL subsystems (headless mode needs no display, no game controller and no audio device)
+	if (isHeadlessModeEnabled) sdlSubsystemsFlags = SDL_INIT_TIMER | SDL_INIT_EVENTS;
+	else sdlSubsystemsFlags = SDL_INIT_TIMER | SDL_INIT_VIDEO | SDL_INIT_EVENTS | SDL_INIT_GAMECONTROLLER | SDL_INIT_AUDIO;
+	if (SDL_Init(sdlSubsystemsFlags) != 0)
 	{
 		LOG_ERROR("SDL_Init() failed (%s).", SDL_GetError());
 		return -1;
 	}
 	
 	// Engine initialization
-	if (Renderer::initialize(isFullScreenEnabled) != 0) return -1;
+	if (Renderer::initialize(isFullScreenEnabled, isHeadlessModeEnabled) != 0) return -1;
 	if (TextureManager::initialize() != 0) return -1;
 	if (LevelManager::initialize() != 0) return -1;
-	if (AudioManager::initialize() != 0) return -1;
+	if (AudioManager::initialize(!isHeadlessModeEnabled) != 0) return -1;
 	if (ControlManager::initialize() != 0) return -1;
 	if (HeadUpDisplay::initialize() != 0) return -1;
+	if (SnapshotManager::initialize() != 0) return -1;
+	if (WorkerPool::initialize() != 0) return -1;
+	_pointerGameStateMutex = SDL_CreateMutex();
+	if (_pointerGameStateMutex == NULL)
+	{
+		LOG_ERROR("Failed to create the game state mutex (%s).", SDL_GetError());
+		return -1;
+	}
+	_pointerGameResumedCondition = SDL_CreateCond();
+	if (_pointerGameResumedCondition == NULL)
+	{
+		LOG_ERROR("Failed to create the game resuming condition (%s).", SDL_GetError());
+		return -1;
+	}
 	
 	// Create the player now that everything is working
 	pointerPlayer = new PlayerFightingEntity(0, 0); // It will be placed at the right location by the level loading function
@@ -623,8 +1057,9 @@ int main(int argc, char *argv[])
 	// Automatically dispose of allocated resources on program exit (allowing to use exit() elsewhere in the program)
 	atexit(_exitFreeResources);
 	
-	// Initialize pseudo-random numbers generator
-	srand(time(NULL));
+	// Initialize pseudo-random numbers generator (headless mode always uses the same seed to make simulation speed measurements reproducible)
+	if (isHeadlessModeEnabled) srand(0);
+	else srand(time(NULL));
 	
 	// Cache some values
 	// Offset to subtract to the player position to have the scene camera coordinates
@@ -638,6 +1073,14 @@ int main(int argc, char *argv[])
 	
 	LOG_INFORMATION("Game engine successfully initialized.");
 	
+	// Measure the simulation speed instead of playing
+	if (isHeadlessModeEnabled)
+	{
+		if (headlessLevelNumber == -1) _runHeadlessSimulation(0, CONFIGURATION_LEVELS_COUNT - 1);
+		else _runHeadlessSimulation(headlessLevelNumber, headlessLevelNumber);
+		return EXIT_SUCCESS;
+	}
+	
 	// Display the main menu and get user choice
 	bool isMainMenuDisplayed = true;
 	bool isSavegamePresent = SavegameManager::isSavegamePresent(); // Cache value to avoid checking for the file every time the menu is displayed
@@ -705,151 +1148,50 @@ int main(int argc, char *argv[])
 	_loadNextLevel();
 	AudioManager::playMusic();
 	
-	// Create a fake texture to be used by the FPS displaying code, this avoids multiple checks to detect whether the first texture is null
-	if (isFramesPerSecondDisplayingEnabled) pointerFramesPerSecondSdlTexture = Renderer::renderTextToTexture("--", Renderer::TEXT_COLOR_ID_RED, Renderer::FONT_SIZE_ID_BIG); // Provided text can't have a zero character size or it would trigger a SDL error
+	// Update the game logic in its own thread, so it runs in parallel with the rendering
+	_tickPeriod = (SDL_GetPerformanceFrequency() * CONFIGURATION_GAMEPLAY_TICK_PERIOD_MILLISECONDS) / 1000;
+	_pointerGameLogicThread = SDL_CreateThread(_gameLogicThread, "Game logic", NULL);
+	if (_pointerGameLogicThread == NULL)
+	{
+		LOG_ERROR("Failed to create the game logic thread (%s).", SDL_GetError());
+		return -1;
+	}
 	
 	while (1)
 	{
-		Renderer::beginFrame();
+		// Handle all relevant events while the game logic is not updated
+		SDL_LockMutex(_pointerGameStateMutex);
+		isGameExited = _handleEvents();
+		SDL_UnlockMutex(_pointerGameStateMutex);
+		if (isGameExited) goto Exit;
 		
-		// Store the time when the loop started
-		if (isFramesPerSecondDisplayingEnabled)
+		// Nothing moves anymore when the player died or won, so wait for the player to do something instead of displaying the same picture again (a newer snapshot is never stored at the displayed snapshot address)
+		pointerSnapshot = SnapshotManager::getLatestSnapshot();
+		if ((pointerSnapshot != NULL) && (pointerSnapshot == _pointerDisplayedSnapshot) && !pointerSnapshot->isInterpolated)
 		{
-			if (frameRateStartingTime == 0) frameRateStartingTime = SDL_GetTicks();
+			// Display the same snapshot again if no event happened for a while, in case an event telling that the display content was lost has been missed
+			if (SDL_WaitEventTimeout(NULL, CONFIGURATION_DISPLAY_IDLE_EVENT_WAITING_TIMEOUT_MILLISECONDS) == 0) _pointerDisplayedSnapshot = NULL;
+			continue;
 		}
 		
-		// Handle all relevant events
-		while (SDL_PollEvent(&event))
-		{
-			switch (event.type)
-			{
-				case SDL_QUIT:
-					goto Exit;
-					
-				case SDL_CONTROLLERBUTTONUP:
-				case SDL_CONTROLLERBUTTONDOWN:
-				case SDL_CONTROLLERAXISMOTION:
-					ControlManager::handleGameControllerEvent(&event);
-					break;
-					
-				case SDL_KEYUP:
-				case SDL_KEYDOWN:
-					ControlManager::handleKeyboardEvent(&event);
-					break;
-			}
-		}
+		Renderer::beginFrame();
 		
-		// Pause or continue the game
-		if (ControlManager::isKeyPressed(ControlManager::KEY_ID_PAUSE_GAME))
+		// Store the time when the loop started
+		if (isFramesPerSecondDisplayingEnabled)
 		{
-			// Stop playing music while the game is paused (in case the game must be quickly hidden to an incoming person)
-			LOG_DEBUG("Game paused.");
-			AudioManager::pauseMusic(1);
-			
-			// Player won, display a specific menu
-			if (_isGameFinished)
-			{
-				if (Menu::display("Victory !", pointerStringsVictoryMenuItems, 2) == 1) goto Exit;
-			}
-			// Normal pause menu
-			else
-			{
-				switch (Menu::display("Pause", pointerStringsPauseMenuItems, 3))
-				{
-					// Player has selected "Continue"
-					case 0:
-						break;
-					
-					// Player has selected "Restart level"
-					case 1:
-						// Stop currently playing sounds
-						AudioManager::stopAllSounds();
-						
-						// Free all entities
-						_clearAllLists();
-						
-						// Choose level number to load (_loadNextLevel() automatically increments _currentLevelNumber)
-						if (_currentLevelNumber == 0) levelToLoadNumber = 0;
-						else levelToLoadNumber = _currentLevelNumber - 1;
-						
-						// Try to load the level
-						if (LevelManager::loadLevel(levelToLoadNumber) != 0)
-						{
-							LOG_ERROR("Failed to reload level %d.", levelToLoadNumber);
-							exit(-1);
-						}
-						
-						// Restore player life and ammunition count as they were at the level start
-						i = SavegameManager::getSavegameItem(SavegameManager::SAVEGAME_ITEM_ID_PLAYER_MAXIMUM_LIFE_POINTS); // Recycle 'i' variable
-						pointerPlayer->setLifePointsAmount(i);
-						pointerPlayer->setMaximumLifePointsAmount(i);
-						pointerPlayer->setAmmunitionAmount(SavegameManager::getSavegameItem(SavegameManager::SAVEGAME_ITEM_ID_PLAYER_AMMUNITION));
-						
-						// Allow the game to restart if the player is dead
-						if (_isPlayerDead)
-						{
-							_isPlayerDead = false;
-							_isGamePaused = false;
-						}
-						break;
-					
-					default:
-						goto Exit;
-				}
-			}
-			
-			LOG_DEBUG("Game continuing.");
-			AudioManager::pauseMusic(0);
+			if (frameRateStartingTime == 0) frameRateStartingTime = SDL_GetTicks();
 		}
 		
-		// Do not update the game anymore if the player died
-		if (!_isGamePaused)
+		// Display the newest game state (nothing is displayed until the game logic published its first snapshot)
+		if (pointerSnapshot != NULL)
 		{
-			// React to player key press without depending of keyboard key repetition rate
-			// Handle both vertical and horizontal direction movement
-			if ((ControlManager::isKeyPressed(ControlManager::KEY_ID_GO_UP) || ControlManager::isKeyPressed(ControlManager::KEY_ID_GO_DOWN)) && (ControlManager::isKeyPressed(ControlManager::KEY_ID_GO_LEFT) || ControlManager::isKeyPressed(ControlManager::KEY_ID_GO_RIGHT)))
-			{
-				// Keep trace of the last direction the player took to favor it, when this key will be released the previous direction will be favored
-				if (ControlManager::isLastPressedDirectionKeyOnVerticalAxis())
-				{
-					if (ControlManager::isKeyPressed(ControlManager::KEY_ID_GO_UP)) pointerPlayer->moveToUp();
-					else pointerPlayer->moveToDown();
-				}
-				else
-				{
-					if (ControlManager::isKeyPressed(ControlManager::KEY_ID_GO_LEFT)) pointerPlayer->moveToLeft();
-					else pointerPlayer->moveToRight();
-				}
-			}
-			// Handle a single key press
-			else
-			{
-				if (ControlManager::isKeyPressed(ControlManager::KEY_ID_GO_UP)) pointerPlayer->moveToUp();
-				else if (ControlManager::isKeyPressed(ControlManager::KEY_ID_GO_DOWN)) pointerPlayer->moveToDown();
-				else if (ControlManager::isKeyPressed(ControlManager::KEY_ID_GO_LEFT)) pointerPlayer->moveToLeft();
-				else if (ControlManager::isKeyPressed(ControlManager::KEY_ID_GO_RIGHT)) pointerPlayer->moveToRight();
-			}
+			// The red overlay is displayed only once, so the same snapshot must be displayed again without it
+			if (pointerSnapshot->isPlayerHit) _pointerDisplayedSnapshot = NULL;
+			else _pointerDisplayedSnapshot = pointerSnapshot;
 			
-			// Fire a bullet
-			if (ControlManager::isKeyPressed(ControlManager::KEY_ID_PRIMARY_SHOOT))
-			{
-				// Is the player allowed to shoot ?
-				pointerBullet = pointerPlayer->shoot();
-				if (pointerBullet != NULL) _playerBulletsList.push_front(pointerBullet);
-			}
-			// Fire a mortar shell (bullet and mortar shell can be shot in the same time)
-			if (ControlManager::isKeyPressed(ControlManager::KEY_ID_SECONDARY_SHOOT))
-			{
-				// Is the player allowed to shoot ?
-				pointerBullet = pointerPlayer->shootSecondaryFire();
-				if (pointerBullet != NULL) _playerBulletsList.push_front(pointerBullet);
-			}
-			
-			_updateGameLogic();
+			_renderGame(pointerSnapshot);
 		}
 		
-		_renderGame();
-		
 		// Append the FPS string before displaying the rendered frame
 		if (isFramesPerSecondDisplayingEnabled)
 		{
@@ -857,9 +1199,7 @@ int main(int argc, char *argv[])
 			if (SDL_GetTicks() - frameRateStartingTime >= 1000)
 			{
 				// Render the FPS count to a string
-				SDL_DestroyTexture(pointerFramesPerSecondSdlTexture); // Free previously created texture
 				sprintf(stringFramesPerSecond, "%d", framesCount);
-				pointerFramesPerSecondSdlTexture = Renderer::renderTextToTexture(stringFramesPerSecond, Renderer::TEXT_COLOR_ID_RED, Renderer::FONT_SIZE_ID_BIG);
 				
 				// Restart computation
 				framesCount = 0;
@@ -868,12 +1208,22 @@ int main(int argc, char *argv[])
 			else framesCount++;
 			
 			// Display the FPS count to the screen top right side at each frame
-			Renderer::renderTexture(pointerFramesPerSecondSdlTexture, Renderer::displayWidth - 100, 20);
+			Renderer::renderText(stringFramesPerSecond, Renderer::TEXT_COLOR_ID_RED, Renderer::FONT_SIZE_ID_BIG, Renderer::displayWidth - 100, 20);
 		}
 		
 		Renderer::endFrame();
 	}
 	
 Exit:
+	// Stop the game logic before the game objects are released
+	if (_pointerGameLogicThread != NULL)
+	{
+		SDL_LockMutex(_pointerGameStateMutex);
+		_isGameLogicThreadStopped = true;
+		SDL_CondSignal(_pointerGameResumedCondition);
+		SDL_UnlockMutex(_pointerGameStateMutex);
+		SDL_WaitThread(_pointerGameLogicThread, NULL);
+	}
+	
 	return EXIT_SUCCESS;
 }
@@ -2,10 +2,15 @@
  * See MediumEnemyFightingEntity.hpp for description.
  * @author Adrien RICCIARDI
  */
+#include <Configuration.hpp>
 #include <EffectManager.hpp>
 #include <MediumEnemyFightingEntity.hpp>
+#include <ObjectPool.hpp>
 #include <TextureManager.hpp>
 
+/** All medium enemies memory. */
+static ObjectPool<MediumEnemyFightingEntity, CONFIGURATION_OBJECT_POOL_MEDIUM_ENEMIES_COUNT> _pool("medium enemies");
+
 MediumEnemyFightingEntity::MediumEnemyFightingEntity(int x, int y): EnemyFightingEntity(x, y, TextureManager::TEXTURE_ID_MEDIUM_ENEMY_FACING_UP, 2, 3, 2000, TextureManager::TEXTURE_ID_MEDIUM_ENEMY_BULLET_FACING_UP, EffectManager::EFFECT_ID_MEDIUM_ENEMY_MUZZLE_FLASH_FACING_UP, EffectManager::EFFECT_ID_MEDIUM_ENEMY_EXPLOSION) {}
 
 MediumEnemyFightingEntity::~MediumEnemyFightingEntity() {}
@@ -31,7 +36,17 @@ int MediumEnemyFightingEntity::update()
 	return EnemyFightingEntity::update();
 }
 
-BulletMovingEntity *MediumEnemyFightingEntity::_fireBullet(int x, int y)
+void MediumEnemyFightingEntity::_fireBullet(BulletStore *pointerBulletStore, int x, int y)
+{
+	pointerBulletStore->addBullet(x, y, TextureManager::TEXTURE_ID_MEDIUM_ENEMY_BULLET_FACING_UP, 5, _facingDirection, 3, false);
+}
+
+void *MediumEnemyFightingEntity::operator new(size_t size)
+{
+	return _pool.allocate(size);
+}
+
+void MediumEnemyFightingEntity::operator delete(void *pointerObject)
 {
-	return new BulletMovingEntity(x, y, TextureManager::TEXTURE_ID_MEDIUM_ENEMY_BULLET_FACING_UP, 5, _facingDirection, 3, 0);
+	_pool.release(pointerObject);
 }
@@ -3,9 +3,9 @@
  * @author Adrien RICCIARDI
  */
 #include <AudioManager.hpp>
-#include <cassert>
 #include <Configuration.hpp>
 #include <ControlManager.hpp>
+#include <cstring>
 #include <Log.hpp>
 #include <Menu.hpp>
 #include <Renderer.hpp>
@@ -23,119 +23,256 @@ namespace Menu
 		int y; //!< Drawing Y coordinate.
 	} MenuItem;
 
-	/** All items to display. */
-	static MenuItem _menuItems[CONFIGURATION_MENU_MAXIMUM_ITEMS_COUNT];
-	/** How many items to display. */
-	static int _menuItemsCount;
+	/** A menu with all its strings rendered, so it can be displayed again without rendering its strings again. */
+	typedef struct
+	{
+		char stringTitle[CONFIGURATION_MENU_MAXIMUM_STRING_SIZE]; //!< The menu title.
+		char stringsItemsTexts[CONFIGURATION_MENU_MAXIMUM_ITEMS_COUNT][CONFIGURATION_MENU_MAXIMUM_STRING_SIZE]; //!< The menu items.
+		int itemsCount; //!< How many items to display.
+		SDL_Texture *pointerTitleTexture; //!< The menu title texture to render.
+		int titleTextureX; //!< Horizontal coordinate to render the title texture at the screen center.
+		MenuItem items[CONFIGURATION_MENU_MAXIMUM_ITEMS_COUNT]; //!< All items to display.
+		int displayWidth; //!< The display width the strings coordinates have been computed for.
+		int displayHeight; //!< The display height the strings coordinates have been computed for.
+		unsigned int lastDisplayedIndex; //!< Tell when the page was displayed for the last time, so the least recently displayed page can be replaced when the cache is full.
+	} MenuPage;
 
-	/** The menu title texture to render. */
-	static SDL_Texture *_pointerMenuTitleTexture;
-	/** Horizontal coordinate to render the texture at the screen center. */
-	static int _menuTitleTextureX;
+	/** All menus that have been displayed, they are kept until the game exits (a page is replaced only if more different menus are displayed than the cache can hold). */
+	static MenuPage _menuPages[CONFIGURATION_MENU_CACHED_PAGES_COUNT];
+	/** How many cache entries contain a menu. */
+	static int _menuPagesCount = 0;
+	/** Incremented each time a menu is displayed. */
+	static unsigned int _menuDisplaysCounter = 0;
 
-	/** Render all strings to cached textures to avoid rendering them on each frame.
-	* @param pointerStringMenuTitle The menu title.
-	* @param pointerStringsMenuItemsTexts The menu items.
+	/** The menu being displayed. */
+	static MenuPage *_pointerMenuPage;
+
+	/** Display the menu background stretched to fit any screen resolution. */
+	static inline void _renderBackground()
+	{
+		Texture *pointerTexture = TextureManager::getTextureFromId(TextureManager::TEXTURE_ID_MENU_BACKGROUND);
+		Renderer::renderBatchedTexture(pointerTexture->getSDLTexture(), pointerTexture->getSourceRectangle(), NULL);
+	}
+
+	/** Free all textures of a menu page.
+	* @param pointerMenuPage The page.
 	*/
-	static inline void _initialize(const char *pointerStringMenuTitle, const char *pointerStringsMenuItemsTexts[])
+	static void _freeMenuPage(MenuPage *pointerMenuPage)
+	{
+		SDL_DestroyTexture(pointerMenuPage->pointerTitleTexture);
+		for (int i = 0; i < pointerMenuPage->itemsCount; i++)
+		{
+			SDL_DestroyTexture(pointerMenuPage->items[i].pointerNormalTexture);
+			SDL_DestroyTexture(pointerMenuPage->items[i].pointerFocusedTexture);
+		}
+	}
+
+	/** Render all strings of a menu page to textures to avoid rendering them on each frame.
+	* @param pointerMenuPage The page, its title and items texts must be set.
+	*/
+	static void _renderMenuPage(MenuPage *pointerMenuPage)
 	{
-		// Make sure there are not too many items
-		assert(_menuItemsCount <= CONFIGURATION_MENU_MAXIMUM_ITEMS_COUNT);
-		
 		// Handle title texture separately because it is not a menu item (it can't be selected or focused)
 		// Render texture
-		_pointerMenuTitleTexture = Renderer::renderTextToTexture(pointerStringMenuTitle, Renderer::TEXT_COLOR_ID_BLACK, Renderer::FONT_SIZE_ID_BIG);
+		pointerMenuPage->pointerTitleTexture = Renderer::renderTextToTexture(pointerMenuPage->stringTitle, Renderer::TEXT_COLOR_ID_BLACK, Renderer::FONT_SIZE_ID_BIG);
 		// Get texture size
 		int textureWidth, textureHeight;
-		if (SDL_QueryTexture(_pointerMenuTitleTexture, NULL, NULL, &textureWidth, &textureHeight) != 0)
+		if (SDL_QueryTexture(pointerMenuPage->pointerTitleTexture, NULL, NULL, &textureWidth, &textureHeight) != 0)
 		{
 			LOG_ERROR("Failed to query menu title texture information for texture (%s).", SDL_GetError());
 			exit(-1);
 		}
 		// Compute X coordinate to center the texture
-		_menuTitleTextureX = (Renderer::displayWidth - textureWidth) / 2;
+		pointerMenuPage->titleTextureX = (Renderer::displayWidth - textureWidth) / 2;
 		
 		// Handle menu items
 		int i;
-		for (i = 0; i < _menuItemsCount; i++)
+		MenuItem *pointerMenuItem;
+		for (i = 0; i < pointerMenuPage->itemsCount; i++)
 		{
 			// Render strings
-			_menuItems[i].pointerNormalTexture = Renderer::renderTextToTexture(pointerStringsMenuItemsTexts[i], Renderer::TEXT_COLOR_DARK_GREY, Renderer::FONT_SIZE_ID_BIG);
-			_menuItems[i].pointerFocusedTexture = Renderer::renderTextToTexture(pointerStringsMenuItemsTexts[i], Renderer::TEXT_COLOR_LIGHT_GREY, Renderer::FONT_SIZE_ID_BIG);
+			pointerMenuItem = &pointerMenuPage->items[i];
+			pointerMenuItem->pointerNormalTexture = Renderer::renderTextToTexture(pointerMenuPage->stringsItemsTexts[i], Renderer::TEXT_COLOR_DARK_GREY, Renderer::FONT_SIZE_ID_BIG);
+			pointerMenuItem->pointerFocusedTexture = Renderer::renderTextToTexture(pointerMenuPage->stringsItemsTexts[i], Renderer::TEXT_COLOR_LIGHT_GREY, Renderer::FONT_SIZE_ID_BIG);
 			
 			// Compute displaying coordinates
 			// Get texture size (texture have same size because only color changes between normal and focused textures, so use the normal one)
-			if (SDL_QueryTexture(_menuItems[i].pointerNormalTexture, NULL, NULL, &textureWidth, &textureHeight) != 0)
+			if (SDL_QueryTexture(pointerMenuItem->pointerNormalTexture, NULL, NULL, &textureWidth, &textureHeight) != 0)
 			{
 				LOG_ERROR("Failed to query texture information for texture %d (%s).", i, SDL_GetError());
 				exit(-1);
 			}
 			
 			// Compute X coordinate to center the texture
-			_menuItems[i].x = (Renderer::displayWidth - textureWidth) / 2;
+			pointerMenuItem->x = (Renderer::displayWidth - textureWidth) / 2;
 			
 			// Each string is vertically spaced from the other ones by a fixed amount of pixels
-			_menuItems[i].y = i * CONFIGURATION_MENU_ITEM_STRINGS_VERTICAL_SPACING;
+			pointerMenuItem->y = i * CONFIGURATION_MENU_ITEM_STRINGS_VERTICAL_SPACING;
 		}
 		
 		// Total vertical size of all string textures is the amount of strings * vertical spacing + the last texture height (because it is displayed starting from the last vertical spacing)
-		int stringTexturesVerticalHeight = (_menuItemsCount * CONFIGURATION_MENU_ITEM_STRINGS_VERTICAL_SPACING) + textureHeight; // The textureHeight variable contains the last texture height
+		int stringTexturesVerticalHeight = (pointerMenuPage->itemsCount * CONFIGURATION_MENU_ITEM_STRINGS_VERTICAL_SPACING) + textureHeight; // The textureHeight variable contains the last texture height
 		int firstStringTextureY = (Renderer::displayHeight - stringTexturesVerticalHeight) / 2;
 
 		// Add Y offset to all texture coordinates, preserving the yet existing spacing
-		for (i = 0; i < _menuItemsCount; i++) _menuItems[i].y += firstStringTextureY;
+		for (i = 0; i < pointerMenuPage->itemsCount; i++) pointerMenuPage->items[i].y += firstStringTextureY;
+		
+		pointerMenuPage->displayWidth = Renderer::displayWidth;
+		pointerMenuPage->displayHeight = Renderer::displayHeight;
+		LOG_DEBUG("Rendered menu \"%s\".", pointerMenuPage->stringTitle);
 	}
 
-	/** Free all textures. */
-	static inline void _uninitialize()
+	/** Select the page to display, rendering its strings only if the same menu has not been displayed yet.
+	* @param pointerStringMenuTitle The menu title.
+	* @param pointerStringsMenuItemsTexts The menu items.
+	* @param menuItemsCount How many menu items to display.
+	*/
+	static void _selectMenuPage(const char *pointerStringMenuTitle, const char *pointerStringsMenuItemsTexts[], int menuItemsCount)
 	{
-		// Free all textures
-		SDL_DestroyTexture(_pointerMenuTitleTexture);
-		for (int i = 0; i < _menuItemsCount; i++)
+		int i, j;
+		MenuPage *pointerMenuPage;
+		
+		// Make sure there are not too many items
+		if (menuItemsCount > CONFIGURATION_MENU_MAXIMUM_ITEMS_COUNT)
 		{
-			SDL_DestroyTexture(_menuItems[i].pointerNormalTexture);
-			SDL_DestroyTexture(_menuItems[i].pointerFocusedTexture);
+			LOG_ERROR("The menu \"%s\" has too many items (%d items, the maximum is %d).", pointerStringMenuTitle, menuItemsCount, CONFIGURATION_MENU_MAXIMUM_ITEMS_COUNT);
+			exit(-1);
+		}
+		_menuDisplaysCounter++;
+		
+		// Is the same menu already cached ? (strings are compared, not pointers, so menus built at runtime are cached too)
+		for (i = 0; i < _menuPagesCount; i++)
+		{
+			pointerMenuPage = &_menuPages[i];
+			if ((pointerMenuPage->itemsCount != menuItemsCount) || (strcmp(pointerMenuPage->stringTitle, pointerStringMenuTitle) != 0)) continue;
+			for (j = 0; j < menuItemsCount; j++)
+			{
+				if (strcmp(pointerMenuPage->stringsItemsTexts[j], pointerStringsMenuItemsTexts[j]) != 0) break;
+			}
+			if (j < menuItemsCount) continue;
+			
+			// The strings coordinates depend on the display size
+			if ((pointerMenuPage->displayWidth != Renderer::displayWidth) || (pointerMenuPage->displayHeight != Renderer::displayHeight))
+			{
+				_freeMenuPage(pointerMenuPage);
+				_renderMenuPage(pointerMenuPage);
+			}
+			
+			pointerMenuPage->lastDisplayedIndex = _menuDisplaysCounter;
+			_pointerMenuPage = pointerMenuPage;
+			return;
+		}
+		
+		// Use a free cache entry, or replace the least recently displayed page
+		if (_menuPagesCount < CONFIGURATION_MENU_CACHED_PAGES_COUNT)
+		{
+			pointerMenuPage = &_menuPages[_menuPagesCount];
+			_menuPagesCount++;
+		}
+		else
+		{
+			pointerMenuPage = &_menuPages[0];
+			for (i = 1; i < _menuPagesCount; i++)
+			{
+				if (_menuPages[i].lastDisplayedIndex < pointerMenuPage->lastDisplayedIndex) pointerMenuPage = &_menuPages[i];
+			}
+			_freeMenuPage(pointerMenuPage);
+		}
+		
+		// Keep a copy of the strings to be able to recognize the menu later (menus can be built at runtime, so check the strings size even in release builds)
+		if (strlen(pointerStringMenuTitle) >= sizeof(pointerMenuPage->stringTitle))
+		{
+			LOG_ERROR("The menu title \"%s\" is too long (the maximum size is %d bytes).", pointerStringMenuTitle, CONFIGURATION_MENU_MAXIMUM_STRING_SIZE);
+			exit(-1);
 		}
+		strcpy(pointerMenuPage->stringTitle, pointerStringMenuTitle);
+		for (i = 0; i < menuItemsCount; i++)
+		{
+			if (strlen(pointerStringsMenuItemsTexts[i]) >= sizeof(pointerMenuPage->stringsItemsTexts[i]))
+			{
+				LOG_ERROR("The menu item %d string \"%s\" is too long (the maximum size is %d bytes).", i, pointerStringsMenuItemsTexts[i], CONFIGURATION_MENU_MAXIMUM_STRING_SIZE);
+				exit(-1);
+			}
+			strcpy(pointerMenuPage->stringsItemsTexts[i], pointerStringsMenuItemsTexts[i]);
+		}
+		pointerMenuPage->itemsCount = menuItemsCount;
+		
+		_renderMenuPage(pointerMenuPage);
+		pointerMenuPage->lastDisplayedIndex = _menuDisplaysCounter;
+		_pointerMenuPage = pointerMenuPage;
 	}
 
-	int display(const char *pointerStringMenuTitle, const char *pointerStringsMenuItemsTexts[], int menuItemsCount)
+	/** Handle all pending events.
+	* @param isWaitingEnabled Set to true to wait for an event to happen before handling the events, the waiting is limited to a short time so the menu is still displayed again if an event is missed.
+	* @param pointerIsRedrawNeeded On output, set to true if the menu must be displayed again, or left unmodified otherwise.
+	* @return -1 if the user pressed Alt+F4 or closed the window,
+	* @return 0 otherwise.
+	*/
+	static int _handleEvents(bool isWaitingEnabled, bool *pointerIsRedrawNeeded)
 	{
 		SDL_Event event;
+		
+		// The event is not removed from the queue, it is handled with the other pending events
+		if (isWaitingEnabled)
+		{
+			// Display the menu again if no event happened for a while, in case an event telling that the display content was lost has been missed
+			if (SDL_WaitEventTimeout(NULL, CONFIGURATION_DISPLAY_IDLE_EVENT_WAITING_TIMEOUT_MILLISECONDS) == 0) *pointerIsRedrawNeeded = true;
+		}
+		
+		while (SDL_PollEvent(&event))
+		{
+			switch (event.type)
+			{
+				// User closed the game window or pressed alt+F4
+				case SDL_QUIT:
+					return -1;
+					
+				case SDL_CONTROLLERBUTTONUP:
+				case SDL_CONTROLLERBUTTONDOWN:
+				case SDL_CONTROLLERAXISMOTION:
+					ControlManager::handleGameControllerEvent(&event);
+					break;
+						
+				case SDL_KEYUP:
+				case SDL_KEYDOWN:
+					ControlManager::handleKeyboardEvent(&event);
+					break;
+					
+				// The window content may have been lost (the window was hidden or resized, or the renderer lost its textures)
+				case SDL_WINDOWEVENT:
+				case SDL_RENDER_TARGETS_RESET:
+				case SDL_RENDER_DEVICE_RESET:
+					*pointerIsRedrawNeeded = true;
+					break;
+			}
+		}
+		
+		return 0;
+	}
+
+	void uninitialize()
+	{
+		for (int i = 0; i < _menuPagesCount; i++) _freeMenuPage(&_menuPages[i]);
+		_menuPagesCount = 0;
+	}
+
+	int display(const char *pointerStringMenuTitle, const char *pointerStringsMenuItemsTexts[], int menuItemsCount)
+	{
 		int returnValue, i, focusedMenuItemIndex = 0, isGoUpKeyPressed = 0, isGoDownKeyPressed = 0, isSelectKeyPressed = 0;
 		SDL_Texture *pointerTexture;
+		bool isRedrawNeeded = true;
 		
-		// This variable is shared by all internal functions, it must be initialized before calling any of the functions
-		_menuItemsCount = menuItemsCount;
-		
-		// Cache textures to display
-		_initialize(pointerStringMenuTitle, pointerStringsMenuItemsTexts);
+		// Get the textures to display (they are rendered only the first time a menu is displayed)
+		_selectMenuPage(pointerStringMenuTitle, pointerStringsMenuItemsTexts, menuItemsCount);
 		
 		while (1)
 		{
-			Renderer::beginFrame();
-			
-			// Process SDL events
-			while (SDL_PollEvent(&event))
+			// Process SDL events (nothing changes on a menu until an event happens, so wait for an event instead of displaying the same picture again)
+			if (_handleEvents(!isRedrawNeeded, &isRedrawNeeded) != 0)
 			{
-				switch (event.type)
-				{
-					// User closed the game window or pressed alt+F4
-					case SDL_QUIT:
-						returnValue = -1;
-						LOG_DEBUG("Quitting game.");
-						goto Exit;
-						
-					case SDL_CONTROLLERBUTTONUP:
-					case SDL_CONTROLLERBUTTONDOWN:
-					case SDL_CONTROLLERAXISMOTION:
-						ControlManager::handleGameControllerEvent(&event);
-						break;
-							
-					case SDL_KEYUP:
-					case SDL_KEYDOWN:
-						ControlManager::handleKeyboardEvent(&event);
-						break;
-				}
+				returnValue = -1;
+				LOG_DEBUG("Quitting game.");
+				goto Exit;
 			}
 			
 			// Handle key press
@@ -147,6 +284,7 @@ namespace Menu
 					AudioManager::playSound(AudioManager::SOUND_ID_MENU_MOVE);
 					if (focusedMenuItemIndex > 0) focusedMenuItemIndex--;
 					isGoUpKeyPressed = 1;
+					isRedrawNeeded = true;
 				}
 			}
 			else isGoUpKeyPressed = 0;
@@ -156,8 +294,9 @@ namespace Menu
 				if (!isGoDownKeyPressed)
 				{
 					AudioManager::playSound(AudioManager::SOUND_ID_MENU_MOVE);
-					if (focusedMenuItemIndex < _menuItemsCount - 1) focusedMenuItemIndex++;
+					if (focusedMenuItemIndex < _pointerMenuPage->itemsCount - 1) focusedMenuItemIndex++;
 					isGoDownKeyPressed = 1;
+					isRedrawNeeded = true;
 				}
 			}
 			else isGoDownKeyPressed = 0;
@@ -173,34 +312,35 @@ namespace Menu
 				goto Exit;
 			}
 			
-			// Display menu
+			// Display menu only if it changed
+			if (!isRedrawNeeded) continue;
+			Renderer::beginFrame();
 			// Display stretched background (so it can fit any screen resolution)
-			SDL_RenderCopy(Renderer::pointerRenderer, TextureManager::getTextureFromId(TextureManager::TEXTURE_ID_MENU_BACKGROUND)->getSDLTexture(), NULL, NULL);
+			_renderBackground();
 			// Display title
-			Renderer::renderTexture(_pointerMenuTitleTexture, _menuTitleTextureX, CONFIGURATION_MENU_TITLE_Y);
+			Renderer::renderTexture(_pointerMenuPage->pointerTitleTexture, _pointerMenuPage->titleTextureX, CONFIGURATION_MENU_TITLE_Y);
 			// Display items
-			for (i = 0; i < _menuItemsCount; i++)
+			for (i = 0; i < _pointerMenuPage->itemsCount; i++)
 			{
 				// Select the right texture according to the focus state
-				if (i == focusedMenuItemIndex) pointerTexture = _menuItems[i].pointerFocusedTexture;
-				else pointerTexture = _menuItems[i].pointerNormalTexture;
+				if (i == focusedMenuItemIndex) pointerTexture = _pointerMenuPage->items[i].pointerFocusedTexture;
+				else pointerTexture = _pointerMenuPage->items[i].pointerNormalTexture;
 				
-				Renderer::renderTexture(pointerTexture, _menuItems[i].x, _menuItems[i].y);
+				Renderer::renderTexture(pointerTexture, _pointerMenuPage->items[i].x, _pointerMenuPage->items[i].y);
 			}
 			
 			Renderer::endFrame();
+			isRedrawNeeded = false;
 		}
 		
 	Exit:
-		// Free resources
-		_uninitialize();
 		return returnValue;
 	}
 	
 	int displayControlsMenu()
 	{
-		SDL_Event event;
 		int returnValue, i, isSelectKeyPressed = 0;
+		bool isRedrawNeeded = true;
 		static const char *pointerStringMenuItems[] =
 		{
 			"Arrow keys or WASD : move",
@@ -210,38 +350,17 @@ namespace Menu
 			"Back"
 		};
 		
-		// This variable is shared by all internal functions, it must be initialized before calling any of the functions
-		_menuItemsCount = 5;
-		
-		// Cache textures to display
-		_initialize("Controls", pointerStringMenuItems);
+		// Get the textures to display (they are rendered only the first time the menu is displayed)
+		_selectMenuPage("Controls", pointerStringMenuItems, 5);
 		
 		while (1)
 		{
-			Renderer::beginFrame();
-			
-			// Process SDL events
-			while (SDL_PollEvent(&event))
+			// Process SDL events (nothing changes on a menu until an event happens, so wait for an event instead of displaying the same picture again)
+			if (_handleEvents(!isRedrawNeeded, &isRedrawNeeded) != 0)
 			{
-				switch (event.type)
-				{
-					// User closed the game window or pressed alt+F4
-					case SDL_QUIT:
-						returnValue = -1;
-						LOG_DEBUG("Quitting game.");
-						goto Exit;
-						
-					case SDL_CONTROLLERBUTTONUP:
-					case SDL_CONTROLLERBUTTONDOWN:
-					case SDL_CONTROLLERAXISMOTION:
-						ControlManager::handleGameControllerEvent(&event);
-						break;
-							
-					case SDL_KEYUP:
-					case SDL_KEYDOWN:
-						ControlManager::handleKeyboardEvent(&event);
-						break;
-				}
+				returnValue = -1;
+				LOG_DEBUG("Quitting game.");
+				goto Exit;
 			}
 			
 			// Handle key press
@@ -255,22 +374,23 @@ namespace Menu
 				goto Exit;
 			}
 			
-			// Display menu
+			// Display menu only if it changed
+			if (!isRedrawNeeded) continue;
+			Renderer::beginFrame();
 			// Display stretched background (so it can fit any screen resolution)
-			SDL_RenderCopy(Renderer::pointerRenderer, TextureManager::getTextureFromId(TextureManager::TEXTURE_ID_MENU_BACKGROUND)->getSDLTexture(), NULL, NULL);
+			_renderBackground();
 			// Display title
-			Renderer::renderTexture(_pointerMenuTitleTexture, _menuTitleTextureX, CONFIGURATION_MENU_TITLE_Y);
+			Renderer::renderTexture(_pointerMenuPage->pointerTitleTexture, _pointerMenuPage->titleTextureX, CONFIGURATION_MENU_TITLE_Y);
 			// Display items (do not draw the final "Back" texture)
-			for (i = 0; i < _menuItemsCount - 1; i++) Renderer::renderTexture(_menuItems[i].pointerNormalTexture, 20, _menuItems[i].y); // Use only default color texture and force left alignment
+			for (i = 0; i < _pointerMenuPage->itemsCount - 1; i++) Renderer::renderTexture(_pointerMenuPage->items[i].pointerNormalTexture, 20, _pointerMenuPage->items[i].y); // Use only default color texture and force left alignment
 			// Draw "Back" like it is a selected button
-			Renderer::renderTexture(_menuItems[_menuItemsCount - 1].pointerFocusedTexture, _menuItems[_menuItemsCount - 1].x, _menuItems[_menuItemsCount - 1].y);
+			Renderer::renderTexture(_pointerMenuPage->items[_pointerMenuPage->itemsCount - 1].pointerFocusedTexture, _pointerMenuPage->items[_pointerMenuPage->itemsCount - 1].x, _pointerMenuPage->items[_pointerMenuPage->itemsCount - 1].y);
 			
 			Renderer::endFrame();
+			isRedrawNeeded = false;
 		}
 		
 		Exit:
-		// Free resources
-		_uninitialize();
 		return returnValue;
 	}
 }
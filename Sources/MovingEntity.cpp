@@ -5,7 +5,8 @@
 #include <Configuration.hpp>
 #include <LevelManager.hpp>
 #include <MovingEntity.hpp>
-#include <Renderer.hpp>
+#include <SnapshotManager.hpp>
+#include <TimeManager.hpp>
 
 MovingEntity::MovingEntity(int x, int y, TextureManager::TextureId facingUpTextureId, int movingPixelsAmount)
 {
@@ -26,6 +27,11 @@ MovingEntity::MovingEntity(int x, int y, TextureManager::TextureId facingUpTextu
 	
 	_movingPixelsAmount = movingPixelsAmount;
 	
+	// The entity has not moved yet, so there is nothing to interpolate
+	_previousX = x;
+	_previousY = y;
+	_previousPositionTime = TimeManager::getTicks();
+	
 	// Collide with walls by default
 	_collisionBlockContent = LevelManager::BLOCK_CONTENT_WALL;
 	
@@ -47,6 +53,10 @@ void MovingEntity::setX(int x)
 	_positionRectangles[DIRECTION_DOWN].x = x;
 	_positionRectangles[DIRECTION_LEFT].x = x;
 	_positionRectangles[DIRECTION_RIGHT].x = x;
+	
+	// The entity is teleported, do not interpolate its rendering position from the previous location
+	_previousX = x;
+	_previousPositionTime = TimeManager::getTicks();
 }
 
 int MovingEntity::getY()
@@ -61,6 +71,10 @@ void MovingEntity::setY(int y)
 	_positionRectangles[DIRECTION_DOWN].y = y;
 	_positionRectangles[DIRECTION_LEFT].y = y;
 	_positionRectangles[DIRECTION_RIGHT].y = y;
+	
+	// The entity is teleported, do not interpolate its rendering position from the previous location
+	_previousY = y;
+	_previousPositionTime = TimeManager::getTicks();
 }
 
 SDL_Rect *MovingEntity::getPositionRectangle()
@@ -68,8 +82,24 @@ SDL_Rect *MovingEntity::getPositionRectangle()
 	return &_positionRectangles[_facingDirection];
 }
 
+int MovingEntity::getPreviousX()
+{
+	// The entity did not move during the last game tick
+	if (_previousPositionTime != TimeManager::getTicks()) return _positionRectangles[_facingDirection].x;
+	return _previousX;
+}
+
+int MovingEntity::getPreviousY()
+{
+	// The entity did not move during the last game tick
+	if (_previousPositionTime != TimeManager::getTicks()) return _positionRectangles[_facingDirection].y;
+	return _previousY;
+}
+
 int MovingEntity::moveToUp()
 {
+	_storePreviousPosition();
+	
 	// Check upper border distance against level walls
 	SDL_Rect *pointerPositionRectangle = &_positionRectangles[_facingDirection];
 	int leftSideDistanceToWall = LevelManager::getDistanceFromUpperBlock(pointerPositionRectangle->x, pointerPositionRectangle->y, _collisionBlockContent);
@@ -99,6 +129,8 @@ int MovingEntity::moveToUp()
 
 int MovingEntity::moveToDown()
 {
+	_storePreviousPosition();
+	
 	// Check downer border distance against level walls
 	SDL_Rect *pointerPositionRectangle = &_positionRectangles[_facingDirection];
 	int leftSideDistanceToWall = LevelManager::getDistanceFromDownerBlock(pointerPositionRectangle->x, pointerPositionRectangle->y + pointerPositionRectangle->h, _collisionBlockContent);
@@ -128,6 +160,8 @@ int MovingEntity::moveToDown()
 
 int MovingEntity::moveToLeft()
 {
+	_storePreviousPosition();
+	
 	// Check leftmost border distance against level walls
 	SDL_Rect *pointerPositionRectangle = &_positionRectangles[_facingDirection];
 	int upperSideDistanceToWall = LevelManager::getDistanceFromLeftmostBlock(pointerPositionRectangle->x, pointerPositionRectangle->y, _collisionBlockContent);
@@ -157,6 +191,8 @@ int MovingEntity::moveToLeft()
 
 int MovingEntity::moveToRight()
 {
+	_storePreviousPosition();
+	
 	// Check rightmost border distance against level walls
 	SDL_Rect *pointerPositionRectangle = &_positionRectangles[_facingDirection];
 	int upperSideDistanceToWall = LevelManager::getDistanceFromRightmostBlock(pointerPositionRectangle->x + pointerPositionRectangle->w, pointerPositionRectangle->y, _collisionBlockContent);
@@ -225,29 +261,24 @@ void MovingEntity::turnToRight()
 	_facingDirection = DIRECTION_RIGHT;
 }
 
-void MovingEntity::render()
+void MovingEntity::addToSnapshot()
 {
-	// Display the texture
-	SDL_Rect *pointerPositionRectangle = &_positionRectangles[_facingDirection];
-	_pointerTextures[_facingDirection]->render(pointerPositionRectangle->x - Renderer::displayX, pointerPositionRectangle->y - Renderer::displayY);
+	// Record the texture
+	SnapshotManager::addSprite(_pointerTextures[_facingDirection], getPreviousX(), getPreviousY(), _positionRectangles[_facingDirection].x, _positionRectangles[_facingDirection].y);
 	
 	// Display collision rectangle in debug mode
 	#if CONFIGURATION_LOG_LEVEL == 3
-	{
-		SDL_Rect renderingRectangle, *pointerPositionRectangle;
-		
-		// Position rectangle
-		SDL_SetRenderDrawColor(Renderer::pointerRenderer, 0, 255, 255, 255);
-		
-		pointerPositionRectangle = &_positionRectangles[_facingDirection];
-		renderingRectangle.x = pointerPositionRectangle->x - Renderer::displayX;
-		renderingRectangle.y = pointerPositionRectangle->y - Renderer::displayY;
-		renderingRectangle.w = pointerPositionRectangle->w;
-		renderingRectangle.h = pointerPositionRectangle->h;
-		SDL_RenderDrawRect(Renderer::pointerRenderer, &renderingRectangle);
-		
-		// Restore background color
-		SDL_SetRenderDrawColor(Renderer::pointerRenderer, 0, 0, 0, 255);
-	}
+		SnapshotManager::addDebugRectangle(&_positionRectangles[_facingDirection], 0, 255, 255);
 	#endif
 }
+
+void MovingEntity::_storePreviousPosition()
+{
+	// Keep the position the entity had when the tick started, even if the entity moves several times during the same tick
+	unsigned int currentTime = TimeManager::getTicks();
+	if (_previousPositionTime == currentTime) return;
+	
+	_previousX = _positionRectangles[_facingDirection].x;
+	_previousY = _positionRectangles[_facingDirection].y;
+	_previousPositionTime = currentTime;
+}
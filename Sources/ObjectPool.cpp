@@ -0,0 +1,35 @@
+/** @file ObjectPool.cpp
+ * See ObjectPool.hpp for description.
+ * @author Adrien RICCIARDI
+ */
+#include <Log.hpp>
+#include <ObjectPool.hpp>
+
+ObjectPoolBase *ObjectPoolBase::_pointerFirstPool = NULL;
+
+ObjectPoolBase::ObjectPoolBase(const char *pointerStringName, int slotsCount)
+{
+	_pointerStringName = pointerStringName;
+	_slotsCount = slotsCount;
+	_usedSlotsCount = 0;
+	_maximumUsedSlotsCount = 0;
+	_arenaAllocationsCount = 0;
+	
+	// Pools are created before main() is called, so there is no need to protect the list
+	_pointerNextPool = _pointerFirstPool;
+	_pointerFirstPool = this;
+}
+
+void ObjectPoolBase::logStatistics()
+{
+	ObjectPoolBase *pointerPool;
+	
+	for (pointerPool = _pointerFirstPool; pointerPool != NULL; pointerPool = pointerPool->_pointerNextPool) LOG_INFORMATION("Object pool \"%s\" : %d slots used at most out of %d, %d objects allocated from the level arena.", pointerPool->_pointerStringName, pointerPool->_maximumUsedSlotsCount, pointerPool->_slotsCount, pointerPool->_arenaAllocationsCount);
+}
+
+void ObjectPoolBase::resetAll()
+{
+	ObjectPoolBase *pointerPool;
+	
+	for (pointerPool = _pointerFirstPool; pointerPool != NULL; pointerPool = pointerPool->_pointerNextPool) pointerPool->_reset();
+}
@@ -9,17 +9,11 @@
 #include <LevelManager.hpp>
 #include <Log.hpp>
 #include <PlayerFightingEntity.hpp>
-#include <Renderer.hpp>
 #include <TextureManager.hpp>
+#include <TimeManager.hpp>
 
 PlayerFightingEntity::PlayerFightingEntity(int x, int y): FightingEntity(x, y, TextureManager::TEXTURE_ID_PLAYER_FACING_UP, 3, CONFIGURATION_GAMEPLAY_PLAYER_DEFAULT_LIFE_POINTS_AMOUNT, CONFIGURATION_GAMEPLAY_PLAYER_DEFAULT_PRIMARY_FIRE_TIME_BETWEEN_TWO_SHOTS, TextureManager::TEXTURE_ID_PLAYER_BULLET_FACING_UP, EffectManager::EFFECT_ID_PLAYER_MUZZLE_FLASH_FACING_UP)
 {
-	
-	// Cache rendering coordinates
-	SDL_Rect *pointerPositionRectangle = &_positionRectangles[_facingDirection];
-	_renderingX = (Renderer::displayWidth - pointerPositionRectangle->w) / 2;
-	_renderingY = (Renderer::displayHeight - pointerPositionRectangle->h) / 2;
-	
 	_ammunitionAmount = CONFIGURATION_GAMEPLAY_PLAYER_DEFAULT_AMMUNITION_AMOUNT;
 	
 	// Allow to shoot immediately
@@ -51,25 +45,24 @@ bool PlayerFightingEntity::modifyLife(int lifePointsAmount)
 	return true;
 }
 
-BulletMovingEntity *PlayerFightingEntity::shoot()
+bool PlayerFightingEntity::shoot(BulletStore *pointerBulletStore)
 {
 	// The player can't shoot if it has no more ammunition
-	if ((_currentActiveBonus != BONUS_MACHINE_GUN) && (_ammunitionAmount == 0)) return NULL; // Ammunition are unlimited with "machine gun" bonus
+	if ((_currentActiveBonus != BONUS_MACHINE_GUN) && (_ammunitionAmount == 0)) return false; // Ammunition are unlimited with "machine gun" bonus
 	
 	// Decrement ammunition count if the player shot
-	BulletMovingEntity *pointerBullet = FightingEntity::shoot();
-	if (pointerBullet != NULL)
+	if (FightingEntity::shoot(pointerBulletStore))
 	{
 		if (_currentActiveBonus != BONUS_MACHINE_GUN) _ammunitionAmount--; // Ammunition are unlimited with "machine gun" bonus
-		return pointerBullet;
+		return true;
 	}
-	return NULL;
+	return false;
 }
 
-BulletMovingEntity *PlayerFightingEntity::shootSecondaryFire()
+bool PlayerFightingEntity::shootSecondaryFire(BulletStore *pointerBulletStore)
 {
 	// The player can't shoot if it has no more ammunition
-	if (_ammunitionAmount < CONFIGURATION_GAMEPLAY_PLAYER_SECONDARY_FIRE_NEEDED_AMMUNITION_AMOUNT) return NULL;
+	if (_ammunitionAmount < CONFIGURATION_GAMEPLAY_PLAYER_SECONDARY_FIRE_NEEDED_AMMUNITION_AMOUNT) return false;
 	
 	// Allow to shoot only if enough time elapsed since last shot
 	if (_isSecondaryShootReloadingTimeElapsed)
@@ -85,7 +78,7 @@ BulletMovingEntity *PlayerFightingEntity::shootSecondaryFire()
 		int firingEffectStartingPositionOffsetY = _secondaryFireFiringEffectStartingPositionOffsets[_facingDirection].y;
 		
 		// Create the bullet
-		BulletMovingEntity *pointerBullet = new BulletMovingEntity(entityX + bulletStartingPositionOffsetX, entityY + bulletStartingPositionOffsetY, TextureManager::TEXTURE_ID_PLAYER_BULLET_MORTAR_SHELL_FACING_UP, 4, _facingDirection, 20, 1);
+		pointerBulletStore->addBullet(entityX + bulletStartingPositionOffsetX, entityY + bulletStartingPositionOffsetY, TextureManager::TEXTURE_ID_PLAYER_BULLET_MORTAR_SHELL_FACING_UP, 4, _facingDirection, 20, true);
 		
 		_ammunitionAmount -= CONFIGURATION_GAMEPLAY_PLAYER_SECONDARY_FIRE_NEEDED_AMMUNITION_AMOUNT;
 		
@@ -94,26 +87,20 @@ BulletMovingEntity *PlayerFightingEntity::shootSecondaryFire()
 		// There are enough ammunition to also play the reloading effect (it can be started at the same time that the firing sound because there is a purposely added delay in reloading sound)
 		if (_ammunitionAmount >= CONFIGURATION_GAMEPLAY_PLAYER_SECONDARY_FIRE_NEEDED_AMMUNITION_AMOUNT) AudioManager::playSound(AudioManager::SOUND_ID_PLAYER_MORTAR_SHELL_RELOADING);
 		
-		// Get time after having generated the bullet, in case this takes more than 1 millisecond
+		// Start the reloading delay
 		_isSecondaryShootReloadingTimeElapsed = false;
-		_secondaryFireLastShotTime = SDL_GetTicks();
+		_secondaryFireLastShotTime = TimeManager::getTicks();
 		
-		return pointerBullet;
+		return true;
 	}
 	
-	return NULL; // No shot allowed
-}
-
-void PlayerFightingEntity::render()
-{
-	// Display the player at the screen center
-	_pointerTextures[_facingDirection]->render(_renderingX, _renderingY);
+	return false; // No shot allowed
 }
 
 int PlayerFightingEntity::update()
 {
 	// Check whether the mortar reloading time has elapsed
-	if (SDL_GetTicks() - _secondaryFireLastShotTime >= _secondaryFireTimeBetweenShots) _isSecondaryShootReloadingTimeElapsed = true;
+	if (TimeManager::getTicks() - _secondaryFireLastShotTime >= _secondaryFireTimeBetweenShots) _isSecondaryShootReloadingTimeElapsed = true;
 	
 	// Update mortar HUD state
 	if (_ammunitionAmount < CONFIGURATION_GAMEPLAY_PLAYER_SECONDARY_FIRE_NEEDED_AMMUNITION_AMOUNT) HeadUpDisplay::setMortarState(HeadUpDisplay::MORTAR_STATE_LOW_AMMUNITION);
@@ -126,7 +113,7 @@ int PlayerFightingEntity::update()
 	// Handle bonus
 	if (_bonusRemainingTime > 0)
 	{
-		HeadUpDisplay::setRemainingBonusTime(((_bonusRemainingTime * CONFIGURATION_DISPLAY_REFRESH_PERIOD_MILLISECONDS) / 1000) + 1); // Convert frame time to seconds, add one more second to compensate for integer computation rounding
+		HeadUpDisplay::setRemainingBonusTime(((_bonusRemainingTime * CONFIGURATION_GAMEPLAY_TICK_PERIOD_MILLISECONDS) / 1000) + 1); // Convert game ticks to seconds, add one more second to compensate for integer computation rounding
 		_bonusRemainingTime--;
 	}
 	else
@@ -211,7 +198,7 @@ int PlayerFightingEntity::update()
 		if (_bonusRemainingTime == 0)
 		{
 			// Configure bonus
-			_bonusRemainingTime = 30000 / CONFIGURATION_DISPLAY_REFRESH_PERIOD_MILLISECONDS; // Initialize timer, bonus effect lasts 30s (this method is called each game frame, so adjust time)
+			_bonusRemainingTime = 30000 / CONFIGURATION_GAMEPLAY_TICK_PERIOD_MILLISECONDS; // Initialize timer, bonus effect lasts 30s (this method is called each game tick, so adjust time)
 			_timeBetweenShots = CONFIGURATION_GAMEPLAY_PLAYER_DEFAULT_PRIMARY_FIRE_TIME_BETWEEN_TWO_SHOTS / 3; // Make shoots three times faster
 			_currentActiveBonus = BONUS_MACHINE_GUN;
 			
@@ -238,7 +225,7 @@ int PlayerFightingEntity::update()
 		if (_bonusRemainingTime == 0)
 		{
 			// Configure bonus
-			_bonusRemainingTime = 45000 / CONFIGURATION_DISPLAY_REFRESH_PERIOD_MILLISECONDS; // Initialize timer, bonus effect lasts 45s (this method is called each game frame, so adjust time)
+			_bonusRemainingTime = 45000 / CONFIGURATION_GAMEPLAY_TICK_PERIOD_MILLISECONDS; // Initialize timer, bonus effect lasts 45s (this method is called each game tick, so adjust time)
 			_currentActiveBonus = BONUS_BULLETPROOF_VEST;
 			
 			EffectManager::addEffect(blockX, blockY, EffectManager::EFFECT_ID_BULLETPROOF_VEST_TAKEN);
@@ -261,7 +248,7 @@ int PlayerFightingEntity::update()
 	return 0;
 }
 
-BulletMovingEntity *PlayerFightingEntity::_fireBullet(int x, int y)
+void PlayerFightingEntity::_fireBullet(BulletStore *pointerBulletStore, int x, int y)
 {
-	return new BulletMovingEntity(x, y, TextureManager::TEXTURE_ID_PLAYER_BULLET_FACING_UP, 6, _facingDirection, 1, 1);
+	pointerBulletStore->addBullet(x, y, TextureManager::TEXTURE_ID_PLAYER_BULLET_FACING_UP, 6, _facingDirection, 1, true);
 }
@@ -2,6 +2,7 @@
  * See Renderer.hpp for description.
  * @author Adrien RICCIARDI
  */
+#include <algorithm>
 #include <cassert>
 #include <Configuration.hpp>
 #include <cstdlib>
@@ -14,19 +15,81 @@
 #else
 	#include <SDL2/SDL_ttf.h>
 #endif
+#include <vector>
 
 namespace Renderer
 {
 	/** The game window. */
-	static SDL_Window *_pointerMainWindow;
+	static SDL_Window *_pointerMainWindow = NULL;
+	/** The off-screen surface the software renderer draws to in headless mode. */
+	static SDL_Surface *_pointerHeadlessSurface = NULL;
 
 	/** The fonts used to draw text. */
 	static TTF_Font *_pointerFonts[FONT_SIZE_IDS_COUNT];
 	/** All available text colors. */
 	static SDL_Color _textColors[TEXT_COLOR_IDS_COUNT];
+	/** Display textures with their original colors. */
+	static const SDL_Color _noColorModulation = {255, 255, 255, 255};
+	
+	/** The first character of the glyphs atlas (all characters before are not printable). */
+	static const int GLYPHS_FIRST_CHARACTER = ' ';
+	/** How many characters are stored in the glyphs atlas (all printable ASCII characters). */
+	static const int GLYPHS_COUNT = '~' - GLYPHS_FIRST_CHARACTER + 1;
+	
+	/** A character picture stored in the glyphs atlas. */
+	typedef struct
+	{
+		SDL_Rect sourceRectangle; //!< The glyph location in the atlas texture (the rectangle size is zero if the glyph has nothing to display).
+		int offsetX; //!< Where to display the glyph picture relatively to the pen position.
+		int advance; //!< How many pixels to move the pen to the right after the glyph has been displayed.
+	} Glyph;
+	
+	/** All printable characters of all fonts, rasterized in white when the game starts, so text can be displayed with any color without rasterizing it again. */
+	static SDL_Texture *_pointerGlyphsAtlasTexture = NULL;
+	/** The glyphs of each font. */
+	static Glyph _glyphs[FONT_SIZE_IDS_COUNT][GLYPHS_COUNT];
+	/** The height in pixels of a text line of each font. */
+	static int _fontHeights[FONT_SIZE_IDS_COUNT];
 	
 	/** Store the time in milliseconds when a frame creation started. */
 	static unsigned int _frameStartingTime = 0;
+	/** Tell whether presenting a frame waits for the display vertical synchronization. */
+	static bool _isVerticalSynchronizationEnabled = false;
+
+	#if SDL_VERSION_ATLEAST(2, 0, 18)
+		/** The vertices of all queued textures. Each texture uses 4 vertices : top left, top right, bottom left and bottom right corners. */
+		static SDL_Vertex _batchVertices[CONFIGURATION_DISPLAY_SPRITE_BATCH_MAXIMUM_TEXTURES_COUNT * 4];
+		/** Tell how to build the 2 triangles of each queued texture from the vertices. These values never change. */
+		static int _batchIndexes[CONFIGURATION_DISPLAY_SPRITE_BATCH_MAXIMUM_TEXTURES_COUNT * 6];
+		/** How many textures are currently queued. */
+		static int _batchTexturesCount = 0;
+		/** The SDL texture all queued textures come from. */
+		static SDL_Texture *_pointerBatchSDLTexture = NULL;
+		/** The batch SDL texture width in pixels, used to convert pixel coordinates to texture coordinates. */
+		static float _batchSDLTextureWidth;
+		/** The batch SDL texture height in pixels, used to convert pixel coordinates to texture coordinates. */
+		static float _batchSDLTextureHeight;
+	#endif
+
+	/** A texture displaying request, it is kept until the frame is displayed. */
+	typedef struct
+	{
+		SDL_Texture *pointerTexture; //!< The SDL texture containing the picture.
+		SDL_Rect sourceRectangle; //!< The picture location in the SDL texture.
+		bool isWholeTextureDisplayed; //!< Set to true to ignore the source rectangle and display the whole SDL texture.
+		SDL_Rect destinationRectangle; //!< Where to display the picture.
+		SDL_Color color; //!< The color the picture pixels are multiplied by.
+		int textureRank; //!< All commands of a layer using the same SDL texture have the same rank, ranks follow the order the SDL textures were used in the layer.
+	} RenderCommand;
+
+	/** All commands queued to each layer. */
+	static std::vector<RenderCommand> _renderCommands[LAYER_IDS_COUNT];
+	/** All different SDL textures used by each layer, in the order they were used. */
+	static std::vector<SDL_Texture *> _layersTextures[LAYER_IDS_COUNT];
+	/** The layer the commands are currently queued to. */
+	static LayerId _currentLayerId = LAYER_ID_SCENE;
+	/** The current render target, commands are queued only when rendering to the display (NULL value). */
+	static SDL_Texture *_pointerRenderTargetTexture = NULL;
 
 	// Public variable, documentation is in the header file
 	SDL_Renderer *pointerRenderer;
@@ -39,10 +102,312 @@ namespace Renderer
 	int displayWidth;
 	int displayHeight;
 
-	int initialize(bool isFullScreenEnabled)
+	/** Display all textures of the geometry batch. */
+	static void _flushBatch()
+	{
+		#if SDL_VERSION_ATLEAST(2, 0, 18)
+			if (_batchTexturesCount > 0) SDL_RenderGeometry(pointerRenderer, _pointerBatchSDLTexture, _batchVertices, _batchTexturesCount * 4, _batchIndexes, _batchTexturesCount * 6);
+			_batchTexturesCount = 0;
+			
+			// Forget the SDL texture, it may be destroyed after the flush and a new texture could be allocated at the same address
+			_pointerBatchSDLTexture = NULL;
+		#endif
+	}
+
+	/** Add a texture area to the geometry batch, the batch is displayed first if it contains textures coming from another SDL texture.
+	* @param pointerTexture The SDL texture containing the picture to display.
+	* @param pointerSourceRectangle The picture location in the SDL texture. Set to NULL to use the whole SDL texture.
+	* @param pointerDestinationRectangle Where to display the picture. Set to NULL to fill the whole render target.
+	* @param pointerColor The color the picture pixels are multiplied by.
+	*/
+	static void _batchTexture(SDL_Texture *pointerTexture, const SDL_Rect *pointerSourceRectangle, const SDL_Rect *pointerDestinationRectangle, const SDL_Color *pointerColor)
+	{
+		#if SDL_VERSION_ATLEAST(2, 0, 18)
+			// Display the queued textures if there is no more room for the new one
+			if (_batchTexturesCount == CONFIGURATION_DISPLAY_SPRITE_BATCH_MAXIMUM_TEXTURES_COUNT) _flushBatch();
+			
+			// Textures coming from different SDL textures can't be rendered at once
+			if (pointerTexture != _pointerBatchSDLTexture)
+			{
+				_flushBatch();
+				
+				int width, height;
+				if (SDL_QueryTexture(pointerTexture, NULL, NULL, &width, &height) != 0)
+				{
+					LOG_ERROR("Failed to query information about the SDL texture (SDL texture pointer : %p), shutting down (%s).", pointerTexture, SDL_GetError());
+					exit(-1);
+				}
+				_pointerBatchSDLTexture = pointerTexture;
+				_batchSDLTextureWidth = width;
+				_batchSDLTextureHeight = height;
+			}
+			
+			// Compute the display area
+			float left, top, right, bottom;
+			if (pointerDestinationRectangle == NULL)
+			{
+				left = 0;
+				top = 0;
+				right = displayWidth;
+				bottom = displayHeight;
+			}
+			else
+			{
+				left = pointerDestinationRectangle->x;
+				top = pointerDestinationRectangle->y;
+				right = pointerDestinationRectangle->x + pointerDestinationRectangle->w;
+				bottom = pointerDestinationRectangle->y + pointerDestinationRectangle->h;
+			}
+			
+			// Compute the texture area in normalized coordinates
+			float textureLeft, textureTop, textureRight, textureBottom;
+			if (pointerSourceRectangle == NULL)
+			{
+				textureLeft = 0;
+				textureTop = 0;
+				textureRight = 1;
+				textureBottom = 1;
+			}
+			else
+			{
+				textureLeft = pointerSourceRectangle->x / _batchSDLTextureWidth;
+				textureTop = pointerSourceRectangle->y / _batchSDLTextureHeight;
+				textureRight = (pointerSourceRectangle->x + pointerSourceRectangle->w) / _batchSDLTextureWidth;
+				textureBottom = (pointerSourceRectangle->y + pointerSourceRectangle->h) / _batchSDLTextureHeight;
+			}
+			
+			// Queue the texture corners
+			SDL_Vertex *pointerVertices = &_batchVertices[_batchTexturesCount * 4];
+			pointerVertices[0].position.x = left;
+			pointerVertices[0].position.y = top;
+			pointerVertices[0].tex_coord.x = textureLeft;
+			pointerVertices[0].tex_coord.y = textureTop;
+			pointerVertices[1].position.x = right;
+			pointerVertices[1].position.y = top;
+			pointerVertices[1].tex_coord.x = textureRight;
+			pointerVertices[1].tex_coord.y = textureTop;
+			pointerVertices[2].position.x = left;
+			pointerVertices[2].position.y = bottom;
+			pointerVertices[2].tex_coord.x = textureLeft;
+			pointerVertices[2].tex_coord.y = textureBottom;
+			pointerVertices[3].position.x = right;
+			pointerVertices[3].position.y = bottom;
+			pointerVertices[3].tex_coord.x = textureRight;
+			pointerVertices[3].tex_coord.y = textureBottom;
+			pointerVertices[0].color = *pointerColor;
+			pointerVertices[1].color = *pointerColor;
+			pointerVertices[2].color = *pointerColor;
+			pointerVertices[3].color = *pointerColor;
+			_batchTexturesCount++;
+		#else
+			// Geometry rendering is not available with this SDL version, display the texture immediately
+			if ((pointerColor->r == 255) && (pointerColor->g == 255) && (pointerColor->b == 255)) SDL_RenderCopy(pointerRenderer, pointerTexture, pointerSourceRectangle, pointerDestinationRectangle);
+			else
+			{
+				SDL_SetTextureColorMod(pointerTexture, pointerColor->r, pointerColor->g, pointerColor->b);
+				SDL_RenderCopy(pointerRenderer, pointerTexture, pointerSourceRectangle, pointerDestinationRectangle);
+				SDL_SetTextureColorMod(pointerTexture, 255, 255, 255);
+			}
+		#endif
+	}
+
+	/** Queue a texture area to the current layer, or display it immediately when rendering to a texture.
+	* @param pointerTexture The SDL texture containing the picture to display.
+	* @param pointerSourceRectangle The picture location in the SDL texture. Set to NULL to use the whole SDL texture.
+	* @param pointerDestinationRectangle Where to display the picture. Set to NULL to fill the whole display.
+	* @param pointerColor The color the picture pixels are multiplied by.
+	*/
+	static void _queueTexture(SDL_Texture *pointerTexture, const SDL_Rect *pointerSourceRectangle, const SDL_Rect *pointerDestinationRectangle, const SDL_Color *pointerColor)
+	{
+		// Textures rendered to another texture are immediately displayed
+		if (_pointerRenderTargetTexture != NULL)
+		{
+			_batchTexture(pointerTexture, pointerSourceRectangle, pointerDestinationRectangle, pointerColor);
+			return;
+		}
+		
+		RenderCommand command;
+		if (pointerDestinationRectangle == NULL)
+		{
+			command.destinationRectangle.x = 0;
+			command.destinationRectangle.y = 0;
+			command.destinationRectangle.w = displayWidth;
+			command.destinationRectangle.h = displayHeight;
+		}
+		else
+		{
+			// Do not queue textures that are not visible on the screen
+			if ((pointerDestinationRectangle->x + pointerDestinationRectangle->w < 0) || (pointerDestinationRectangle->y + pointerDestinationRectangle->h < 0) || (pointerDestinationRectangle->x >= displayWidth) || (pointerDestinationRectangle->y >= displayHeight)) return;
+			command.destinationRectangle = *pointerDestinationRectangle;
+		}
+		command.pointerTexture = pointerTexture;
+		if (pointerSourceRectangle == NULL) command.isWholeTextureDisplayed = true;
+		else
+		{
+			command.sourceRectangle = *pointerSourceRectangle;
+			command.isWholeTextureDisplayed = false;
+		}
+		command.color = *pointerColor;
+		
+		// Find the texture rank (most of the time the previous command used the same SDL texture)
+		std::vector<RenderCommand> *pointerCommands = &_renderCommands[_currentLayerId];
+		if (!pointerCommands->empty() && (pointerCommands->back().pointerTexture == pointerTexture)) command.textureRank = pointerCommands->back().textureRank;
+		else
+		{
+			std::vector<SDL_Texture *> *pointerTextures = &_layersTextures[_currentLayerId];
+			int i, texturesCount = (int) pointerTextures->size();
+			for (i = 0; i < texturesCount; i++)
+			{
+				if ((*pointerTextures)[i] == pointerTexture) break;
+			}
+			if (i == texturesCount) pointerTextures->push_back(pointerTexture);
+			command.textureRank = i;
+		}
+		
+		pointerCommands->push_back(command);
+	}
+
+	/** Rasterize all printable characters of all fonts to a single texture.
+	* @return 0 if the glyphs atlas was successfully created,
+	* @return -1 if an error occurred.
+	*/
+	static int _createGlyphsAtlas()
+	{
+		SDL_Surface *pointerGlyphsSurfaces[FONT_SIZE_IDS_COUNT][GLYPHS_COUNT] = {{NULL}}, *pointerAtlasSurface = NULL, *pointerGlyphSurface;
+		int fontSizeId, i, x = 0, y = 0, rowHeight = 0, minimumX, returnValue = -1;
+		Glyph *pointerGlyph;
+		
+		// Rasterize all glyphs and place them in rows in the atlas
+		for (fontSizeId = 0; fontSizeId < FONT_SIZE_IDS_COUNT; fontSizeId++)
+		{
+			_fontHeights[fontSizeId] = TTF_FontHeight(_pointerFonts[fontSizeId]);
+			
+			for (i = 0; i < GLYPHS_COUNT; i++)
+			{
+				pointerGlyph = &_glyphs[fontSizeId][i];
+				if (TTF_GlyphMetrics(_pointerFonts[fontSizeId], static_cast<Uint16>(GLYPHS_FIRST_CHARACTER + i), &minimumX, NULL, NULL, NULL, &pointerGlyph->advance) != 0)
+				{
+					LOG_ERROR("Failed to get the metrics of the character %d (%s).", GLYPHS_FIRST_CHARACTER + i, TTF_GetError());
+					goto Exit;
+				}
+				// A glyph extending on the left of the pen is rasterized starting from its leftmost pixel
+				if (minimumX < 0) pointerGlyph->offsetX = minimumX;
+				else pointerGlyph->offsetX = 0;
+				
+				// Glyphs with nothing to display (like the space) may not be rasterized, only their advance is needed
+				pointerGlyphSurface = TTF_RenderGlyph_Blended(_pointerFonts[fontSizeId], static_cast<Uint16>(GLYPHS_FIRST_CHARACTER + i), _noColorModulation);
+				pointerGlyphsSurfaces[fontSizeId][i] = pointerGlyphSurface;
+				if (pointerGlyphSurface == NULL)
+				{
+					pointerGlyph->sourceRectangle.x = 0;
+					pointerGlyph->sourceRectangle.y = 0;
+					pointerGlyph->sourceRectangle.w = 0;
+					pointerGlyph->sourceRectangle.h = 0;
+					continue;
+				}
+				
+				// Start a new row if the glyph does not fit on the current one
+				if (x + pointerGlyphSurface->w > CONFIGURATION_DISPLAY_GLYPHS_ATLAS_WIDTH)
+				{
+					x = 0;
+					y += rowHeight;
+					rowHeight = 0;
+				}
+				pointerGlyph->sourceRectangle.x = x;
+				pointerGlyph->sourceRectangle.y = y;
+				pointerGlyph->sourceRectangle.w = pointerGlyphSurface->w;
+				pointerGlyph->sourceRectangle.h = pointerGlyphSurface->h;
+				x += pointerGlyphSurface->w;
+				if (pointerGlyphSurface->h > rowHeight) rowHeight = pointerGlyphSurface->h;
+			}
+		}
+		
+		// Gather all glyphs on the same surface
+		pointerAtlasSurface = SDL_CreateRGBSurfaceWithFormat(0, CONFIGURATION_DISPLAY_GLYPHS_ATLAS_WIDTH, y + rowHeight, 32, SDL_PIXELFORMAT_ARGB8888);
+		if (pointerAtlasSurface == NULL)
+		{
+			LOG_ERROR("Failed to create the glyphs atlas surface (%s).", SDL_GetError());
+			goto Exit;
+		}
+		for (fontSizeId = 0; fontSizeId < FONT_SIZE_IDS_COUNT; fontSizeId++)
+		{
+			for (i = 0; i < GLYPHS_COUNT; i++)
+			{
+				pointerGlyphSurface = pointerGlyphsSurfaces[fontSizeId][i];
+				if (pointerGlyphSurface == NULL) continue;
+				
+				// Copy the glyph transparency instead of blending it with the atlas empty pixels
+				SDL_SetSurfaceBlendMode(pointerGlyphSurface, SDL_BLENDMODE_NONE);
+				if (SDL_BlitSurface(pointerGlyphSurface, NULL, pointerAtlasSurface, &_glyphs[fontSizeId][i].sourceRectangle) != 0)
+				{
+					LOG_ERROR("Failed to copy the character %d to the glyphs atlas (%s).", GLYPHS_FIRST_CHARACTER + i, SDL_GetError());
+					goto Exit;
+				}
+			}
+		}
+		
+		// Convert the atlas to a texture to be able to display it
+		_pointerGlyphsAtlasTexture = SDL_CreateTextureFromSurface(pointerRenderer, pointerAtlasSurface);
+		if (_pointerGlyphsAtlasTexture == NULL)
+		{
+			LOG_ERROR("Failed to convert the glyphs atlas surface to a texture (%s).", SDL_GetError());
+			goto Exit;
+		}
+		SDL_SetTextureBlendMode(_pointerGlyphsAtlasTexture, SDL_BLENDMODE_BLEND);
+		LOG_DEBUG("Glyphs atlas size : %dx%d.", pointerAtlasSurface->w, pointerAtlasSurface->h);
+		returnValue = 0;
+		
+	Exit:
+		SDL_FreeSurface(pointerAtlasSurface);
+		for (fontSizeId = 0; fontSizeId < FONT_SIZE_IDS_COUNT; fontSizeId++)
+		{
+			for (i = 0; i < GLYPHS_COUNT; i++) SDL_FreeSurface(pointerGlyphsSurfaces[fontSizeId][i]);
+		}
+		return returnValue;
+	}
+
+	/** Tell whether a render command must be displayed before another one.
+	* @param referenceCommand The first command.
+	* @param comparedCommand The second command.
+	* @return true if the first command SDL texture is displayed before the second command one,
+	* @return false otherwise.
+	*/
+	static bool _compareRenderCommands(const RenderCommand &referenceCommand, const RenderCommand &comparedCommand)
+	{
+		return referenceCommand.textureRank < comparedCommand.textureRank;
+	}
+
+	int initialize(bool isFullScreenEnabled, bool isHeadlessModeEnabled)
 	{
 		unsigned int flags;
 		SDL_RendererInfo rendererInformation;
+		int outputWidth, outputHeight;
+		#if CONFIGURATION_DISPLAY_IS_INTEGER_UPSCALING_ENABLED
+			int scaleFactor;
+		#endif
+		
+		// There is no display in headless mode, but textures still need a renderer to be created, so use a software renderer drawing to memory
+		if (isHeadlessModeEnabled)
+		{
+			displayWidth = CONFIGURATION_DISPLAY_WIDTH;
+			displayHeight = CONFIGURATION_DISPLAY_HEIGHT;
+			
+			_pointerHeadlessSurface = SDL_CreateRGBSurfaceWithFormat(0, displayWidth, displayHeight, 32, SDL_PIXELFORMAT_ARGB8888);
+			if (_pointerHeadlessSurface == NULL)
+			{
+				LOG_ERROR("Failed to create the headless rendering surface (%s).", SDL_GetError());
+				goto Exit_Error;
+			}
+			
+			pointerRenderer = SDL_CreateSoftwareRenderer(_pointerHeadlessSurface);
+			if (pointerRenderer == NULL)
+			{
+				LOG_ERROR("Failed to create the headless software renderer (%s).", SDL_GetError());
+				goto Exit_Error_Destroy_Window;
+			}
+			
+			goto Initialize_Fonts;
+		}
 		
 		// Create the game window
 		if (isFullScreenEnabled) flags = SDL_WINDOW_FULLSCREEN_DESKTOP; // Automatically adjust renderer resolution to the display one
@@ -54,6 +419,9 @@ namespace Renderer
 			goto Exit_Error;
 		}
 		
+		// Select the filtering used to upscale the full screen display (the hint is read when a texture is created, so it must be set before any texture exists)
+		if (isFullScreenEnabled) SDL_SetHint(SDL_HINT_RENDER_SCALE_QUALITY, CONFIGURATION_DISPLAY_UPSCALING_QUALITY);
+		
 		// Create the window renderer
 		pointerRenderer = SDL_CreateRenderer(_pointerMainWindow, -1, SDL_RENDERER_ACCELERATED | SDL_RENDERER_PRESENTVSYNC);
 		if (pointerRenderer == NULL)
@@ -63,7 +431,14 @@ namespace Renderer
 		}
 		
 		// Display rendering driver name
-		if (SDL_GetRendererInfo(pointerRenderer, &rendererInformation) == 0) LOG_DEBUG("Rendering driver : %s.", rendererInformation.name);
+		if (SDL_GetRendererInfo(pointerRenderer, &rendererInformation) == 0)
+		{
+			LOG_DEBUG("Rendering driver : %s.", rendererInformation.name);
+			
+			// Vertical synchronization may not be granted by the driver, in this case the frame rate will be limited by software
+			if (rendererInformation.flags & SDL_RENDERER_PRESENTVSYNC) _isVerticalSynchronizationEnabled = true;
+			LOG_DEBUG("Vertical synchronization : %s.", _isVerticalSynchronizationEnabled ? "enabled" : "disabled");
+		}
 		
 		// Set display size according to selected mode
 		if (isFullScreenEnabled)
@@ -73,6 +448,32 @@ namespace Renderer
 				LOG_ERROR("Failed to get renderer output size (%s).", SDL_GetError());
 				goto Exit_Error_Destroy_Window;
 			}
+			
+			// Render at a fixed height whatever the screen resolution is, so the amount of displayed level and the rendering work stay the same on high resolution screens
+			if (displayHeight > CONFIGURATION_DISPLAY_FULL_SCREEN_LOGICAL_HEIGHT)
+			{
+				outputWidth = displayWidth;
+				outputHeight = displayHeight;
+				
+				#if CONFIGURATION_DISPLAY_IS_INTEGER_UPSCALING_ENABLED
+					// Use the biggest integer factor keeping at least the configured height, the screen is fully used when the output size is a multiple of the resulting display size
+					scaleFactor = outputHeight / CONFIGURATION_DISPLAY_FULL_SCREEN_LOGICAL_HEIGHT;
+					displayWidth = outputWidth / scaleFactor;
+					displayHeight = outputHeight / scaleFactor;
+					if (SDL_RenderSetIntegerScale(pointerRenderer, SDL_TRUE) != 0) LOG_INFORMATION("Failed to enable integer upscaling (%s).", SDL_GetError());
+				#else
+					// Keep the screen aspect ratio
+					displayWidth = (outputWidth * CONFIGURATION_DISPLAY_FULL_SCREEN_LOGICAL_HEIGHT) / outputHeight;
+					displayHeight = CONFIGURATION_DISPLAY_FULL_SCREEN_LOGICAL_HEIGHT;
+				#endif
+				
+				if (SDL_RenderSetLogicalSize(pointerRenderer, displayWidth, displayHeight) != 0)
+				{
+					LOG_ERROR("Failed to set renderer logical size (%s).", SDL_GetError());
+					goto Exit_Error_Destroy_Window;
+				}
+				LOG_DEBUG("Rendering at %dx%d, upscaled to %dx%d.", displayWidth, displayHeight, outputWidth, outputHeight);
+			}
 		}
 		else
 		{
@@ -80,6 +481,7 @@ namespace Renderer
 			displayHeight = CONFIGURATION_DISPLAY_HEIGHT;
 		}
 		
+	Initialize_Fonts:
 		// Initialize SDL TTF
 		if (TTF_Init() != 0)
 		{
@@ -101,8 +503,11 @@ namespace Renderer
 			goto Exit_Error_Uninitialize_TTF;
 		}
 		
+		// Rasterize the characters once for all
+		if (_createGlyphsAtlas() != 0) goto Exit_Error_Uninitialize_TTF;
+		
 		// Hide the cursor in full screen mode
-		if (isFullScreenEnabled)
+		if (isFullScreenEnabled && !isHeadlessModeEnabled)
 		{
 			if (SDL_ShowCursor(SDL_DISABLE) < 0)
 			{
@@ -153,6 +558,22 @@ namespace Renderer
 		_textColors[TEXT_COLOR_DARK_GREY].b = 47;
 		_textColors[TEXT_COLOR_DARK_GREY].a = 255;
 		
+		#if SDL_VERSION_ATLEAST(2, 0, 18)
+			// Textures always use the same triangles, only the vertices positions and colors change
+			int i;
+			for (i = 0; i < CONFIGURATION_DISPLAY_SPRITE_BATCH_MAXIMUM_TEXTURES_COUNT; i++)
+			{
+				// Top left triangle
+				_batchIndexes[i * 6] = i * 4;
+				_batchIndexes[(i * 6) + 1] = (i * 4) + 1;
+				_batchIndexes[(i * 6) + 2] = (i * 4) + 2;
+				// Bottom right triangle
+				_batchIndexes[(i * 6) + 3] = (i * 4) + 2;
+				_batchIndexes[(i * 6) + 4] = (i * 4) + 1;
+				_batchIndexes[(i * 6) + 5] = (i * 4) + 3;
+			}
+		#endif
+		
 		// Everything went fine
 		return 0;
 		
@@ -163,7 +584,8 @@ namespace Renderer
 		SDL_DestroyRenderer(pointerRenderer);
 
 	Exit_Error_Destroy_Window:
-		SDL_DestroyWindow(_pointerMainWindow);
+		if (_pointerMainWindow != NULL) SDL_DestroyWindow(_pointerMainWindow);
+		if (_pointerHeadlessSurface != NULL) SDL_FreeSurface(_pointerHeadlessSurface);
 		
 	Exit_Error:
 		return -1;
@@ -171,11 +593,13 @@ namespace Renderer
 
 	void uninitialize()
 	{
+		SDL_DestroyTexture(_pointerGlyphsAtlasTexture);
 		for (int i = 0; i < FONT_SIZE_IDS_COUNT; i++) TTF_CloseFont(_pointerFonts[i]);
 		TTF_Quit();
 		
 		SDL_DestroyRenderer(pointerRenderer);
-		SDL_DestroyWindow(_pointerMainWindow);
+		if (_pointerMainWindow != NULL) SDL_DestroyWindow(_pointerMainWindow);
+		if (_pointerHeadlessSurface != NULL) SDL_FreeSurface(_pointerHeadlessSurface);
 		SDL_Quit();
 	}
 
@@ -186,13 +610,22 @@ namespace Renderer
 		
 		// Clean the rendering area
 		SDL_RenderClear(pointerRenderer);
+		
+		// Start with the bottommost layer
+		_currentLayerId = LAYER_ID_SCENE;
 	}
 
 	void endFrame()
 	{
+		// Make sure all textures are rendered
+		flushBatch();
+		
 		// Display the rendered picture
 		SDL_RenderPresent(pointerRenderer);
 
+		// SDL_RenderPresent() already waited for the display refresh, so the game can be displayed at the monitor frequency
+		if (_isVerticalSynchronizationEnabled) return;
+
 		// Wait enough time to achieve a 60Hz refresh rate
 		unsigned int frameElapsedTime = SDL_GetTicks() - _frameStartingTime;
 		if (frameElapsedTime < CONFIGURATION_DISPLAY_REFRESH_PERIOD_MILLISECONDS) SDL_Delay(CONFIGURATION_DISPLAY_REFRESH_PERIOD_MILLISECONDS - frameElapsedTime);
@@ -237,7 +670,7 @@ namespace Renderer
 		// Display the texture at the specified coordinates
 		destinationRectangle.x = x;
 		destinationRectangle.y = y;
-		SDL_RenderCopy(pointerRenderer, pointerTexture, NULL, &destinationRectangle);
+		renderBatchedTexture(pointerTexture, NULL, &destinationRectangle);
 	}
 
 	void renderCenteredTexture(SDL_Texture *pointerTexture, int y)
@@ -256,6 +689,117 @@ namespace Renderer
 		else destinationRectangle.y = y;
 		
 		// Display the centered texture
-		SDL_RenderCopy(pointerRenderer, pointerTexture, NULL, &destinationRectangle);
+		renderBatchedTexture(pointerTexture, NULL, &destinationRectangle);
+	}
+
+	void setLayer(LayerId layerId)
+	{
+		assert(layerId < LAYER_IDS_COUNT);
+		_currentLayerId = layerId;
+	}
+
+	void renderBatchedTexture(SDL_Texture *pointerTexture, const SDL_Rect *pointerSourceRectangle, const SDL_Rect *pointerDestinationRectangle)
+	{
+		_queueTexture(pointerTexture, pointerSourceRectangle, pointerDestinationRectangle, &_noColorModulation);
+	}
+
+	void getTextSize(const char *pointerStringText, FontSizeId fontSizeId, int *pointerWidth, int *pointerHeight)
+	{
+		int character, width = 0;
+		
+		assert(fontSizeId < FONT_SIZE_IDS_COUNT);
+		
+		while (*pointerStringText != 0)
+		{
+			// Non printable characters are displayed as a question mark
+			character = static_cast<unsigned char>(*pointerStringText);
+			if ((character < GLYPHS_FIRST_CHARACTER) || (character >= GLYPHS_FIRST_CHARACTER + GLYPHS_COUNT)) character = '?';
+			
+			width += _glyphs[fontSizeId][character - GLYPHS_FIRST_CHARACTER].advance;
+			pointerStringText++;
+		}
+		
+		if (pointerWidth != NULL) *pointerWidth = width;
+		if (pointerHeight != NULL) *pointerHeight = _fontHeights[fontSizeId];
+	}
+
+	void renderText(const char *pointerStringText, TextColorId colorId, FontSizeId fontSizeId, int x, int y)
+	{
+		int character;
+		Glyph *pointerGlyph;
+		SDL_Rect destinationRectangle;
+		
+		// Make sure parameters are valid
+		assert(colorId < TEXT_COLOR_IDS_COUNT);
+		assert(fontSizeId < FONT_SIZE_IDS_COUNT);
+		
+		// Display each character at the pen position, all glyphs come from the same texture so the whole text is displayed at once
+		destinationRectangle.y = y;
+		while (*pointerStringText != 0)
+		{
+			// Non printable characters are displayed as a question mark
+			character = static_cast<unsigned char>(*pointerStringText);
+			if ((character < GLYPHS_FIRST_CHARACTER) || (character >= GLYPHS_FIRST_CHARACTER + GLYPHS_COUNT)) character = '?';
+			pointerGlyph = &_glyphs[fontSizeId][character - GLYPHS_FIRST_CHARACTER];
+			
+			if (pointerGlyph->sourceRectangle.w > 0)
+			{
+				destinationRectangle.x = x + pointerGlyph->offsetX;
+				destinationRectangle.w = pointerGlyph->sourceRectangle.w;
+				destinationRectangle.h = pointerGlyph->sourceRectangle.h;
+				_queueTexture(_pointerGlyphsAtlasTexture, &pointerGlyph->sourceRectangle, &destinationRectangle, &_textColors[colorId]);
+			}
+			
+			x += pointerGlyph->advance;
+			pointerStringText++;
+		}
+	}
+
+	void renderCenteredText(const char *pointerStringText, TextColorId colorId, FontSizeId fontSizeId, int y)
+	{
+		int width, height;
+		
+		getTextSize(pointerStringText, fontSizeId, &width, &height);
+		if (y == -1) y = (displayHeight - height) / 2; // Automatically center on vertical axis
+		renderText(pointerStringText, colorId, fontSizeId, (displayWidth - width) / 2, y);
+	}
+
+	void flushBatch()
+	{
+		int layerId;
+		size_t i;
+		RenderCommand *pointerCommand;
+		
+		// Queued commands always target the display
+		assert(_pointerRenderTargetTexture == NULL);
+		
+		// Layers are displayed from the bottommost one to the topmost one
+		for (layerId = 0; layerId < LAYER_IDS_COUNT; layerId++)
+		{
+			std::vector<RenderCommand> *pointerCommands = &_renderCommands[layerId];
+			
+			// Make the commands using the same SDL texture adjacent, the sort is stable so these commands are still displayed in the order they were queued
+			if (_layersTextures[layerId].size() > 1) std::stable_sort(pointerCommands->begin(), pointerCommands->end(), _compareRenderCommands);
+			
+			for (i = 0; i < pointerCommands->size(); i++)
+			{
+				pointerCommand = &(*pointerCommands)[i];
+				_batchTexture(pointerCommand->pointerTexture, pointerCommand->isWholeTextureDisplayed ? NULL : &pointerCommand->sourceRectangle, &pointerCommand->destinationRectangle, &pointerCommand->color);
+			}
+			
+			pointerCommands->clear();
+			_layersTextures[layerId].clear();
+		}
+		
+		_flushBatch();
+	}
+
+	void setRenderTarget(SDL_Texture *pointerTexture)
+	{
+		// Display the textures rendered to the previous target
+		_flushBatch();
+		
+		SDL_SetRenderTarget(pointerRenderer, pointerTexture);
+		_pointerRenderTargetTexture = pointerTexture;
 	}
 }
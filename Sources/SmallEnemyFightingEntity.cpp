@@ -2,15 +2,30 @@
  * See SmallEnemyFightingEntity.hpp for description.
  * @author Adrien RICCIARDI
  */
+#include <Configuration.hpp>
 #include <EffectManager.hpp>
+#include <ObjectPool.hpp>
 #include <SmallEnemyFightingEntity.hpp>
 #include <TextureManager.hpp>
 
+/** All small enemies memory. */
+static ObjectPool<SmallEnemyFightingEntity, CONFIGURATION_OBJECT_POOL_SMALL_ENEMIES_COUNT> _pool("small enemies");
+
 SmallEnemyFightingEntity::SmallEnemyFightingEntity(int x, int y): EnemyFightingEntity(x, y, TextureManager::TEXTURE_ID_SMALL_ENEMY_FACING_UP, 2, 1, 1000, TextureManager::TEXTURE_ID_SMALL_ENEMY_BULLET_FACING_UP, EffectManager::EFFECT_ID_SMALL_ENEMY_MUZZLE_FLASH_FACING_UP, EffectManager::EFFECT_ID_SMALL_ENEMY_EXPLOSION) {}
 
 SmallEnemyFightingEntity::~SmallEnemyFightingEntity() {}
 
-BulletMovingEntity *SmallEnemyFightingEntity::_fireBullet(int x, int y)
+void SmallEnemyFightingEntity::_fireBullet(BulletStore *pointerBulletStore, int x, int y)
+{
+	pointerBulletStore->addBullet(x, y, TextureManager::TEXTURE_ID_SMALL_ENEMY_BULLET_FACING_UP, 6, _facingDirection, 1, false);
+}
+
+void *SmallEnemyFightingEntity::operator new(size_t size)
+{
+	return _pool.allocate(size);
+}
+
+void SmallEnemyFightingEntity::operator delete(void *pointerObject)
 {
-	return new BulletMovingEntity(x, y, TextureManager::TEXTURE_ID_SMALL_ENEMY_BULLET_FACING_UP, 6, _facingDirection, 1, 0);
+	_pool.release(pointerObject);
 }
@@ -0,0 +1,161 @@
+/** @file SnapshotManager.cpp
+ * See SnapshotManager.hpp for description.
+ * @author Adrien RICCIARDI
+ */
+#include <cassert>
+#include <Log.hpp>
+#include <SDL2/SDL.h>
+#include <SnapshotManager.hpp>
+
+namespace SnapshotManager
+{
+	/** Three snapshots are needed so the simulation thread never waits for the rendering thread : one is being recorded, one is being displayed and the last one is the newest published one. */
+	static Snapshot _snapshots[3];
+
+	/** The snapshot the simulation thread is recording. */
+	static Snapshot *_pointerRecordingSnapshot = &_snapshots[0];
+	/** The newest published snapshot. */
+	static Snapshot *_pointerLatestSnapshot = &_snapshots[1];
+	/** The snapshot the rendering thread is displaying. */
+	static Snapshot *_pointerDisplayedSnapshot = &_snapshots[2];
+
+	/** Tell whether the latest snapshot has been published after the rendering thread got its snapshot. */
+	static bool _isLatestSnapshotNew = false;
+	/** Tell whether a snapshot has been published since the game started. */
+	static bool _isSnapshotPublished = false;
+
+	/** Protect the snapshots exchange. */
+	static SDL_mutex *_pointerMutex = NULL;
+
+	/** The layer the textures are recorded to. */
+	static Renderer::LayerId _currentLayerId;
+
+	/** Transfer the one-shot events of a snapshot the rendering thread did not display to the next snapshot.
+	 * @param pointerDiscardedSnapshot The snapshot that will not be displayed.
+	 * @param pointerNewSnapshot The snapshot replacing it.
+	 */
+	static void _transferSnapshotEvents(Snapshot *pointerDiscardedSnapshot, Snapshot *pointerNewSnapshot)
+	{
+		LevelManager::SceneUpdate *pointerDiscardedSceneUpdate = &pointerDiscardedSnapshot->sceneUpdate, *pointerNewSceneUpdate = &pointerNewSnapshot->sceneUpdate;
+		
+		pointerNewSnapshot->isPlayerHit |= pointerDiscardedSnapshot->isPlayerHit;
+		
+		// A new level makes all previous scene changes meaningless
+		if (pointerNewSceneUpdate->isLevelChanged) return;
+		
+		// Keep the new level of the discarded snapshot
+		if (pointerDiscardedSceneUpdate->isLevelChanged)
+		{
+			pointerNewSceneUpdate->isLevelChanged = true;
+			pointerNewSceneUpdate->widthBlocks = pointerDiscardedSceneUpdate->widthBlocks;
+			pointerNewSceneUpdate->heightBlocks = pointerDiscardedSceneUpdate->heightBlocks;
+			pointerNewSceneUpdate->blocksTextureIds.swap(pointerDiscardedSceneUpdate->blocksTextureIds);
+			pointerNewSceneUpdate->blocksContent.swap(pointerDiscardedSceneUpdate->blocksContent);
+		}
+		
+		// The discarded block changes happened first
+		pointerNewSceneUpdate->blockChanges.insert(pointerNewSceneUpdate->blockChanges.begin(), pointerDiscardedSceneUpdate->blockChanges.begin(), pointerDiscardedSceneUpdate->blockChanges.end());
+	}
+
+	int initialize()
+	{
+		_pointerMutex = SDL_CreateMutex();
+		if (_pointerMutex == NULL)
+		{
+			LOG_ERROR("Failed to create the snapshots mutex (%s).", SDL_GetError());
+			return -1;
+		}
+		
+		return 0;
+	}
+
+	void uninitialize()
+	{
+		SDL_DestroyMutex(_pointerMutex);
+		_pointerMutex = NULL;
+	}
+
+	Snapshot *beginSnapshot()
+	{
+		int i;
+		
+		// Keep the vectors memory, so recording a snapshot does not allocate memory
+		for (i = 0; i < Renderer::LAYER_IDS_COUNT; i++) _pointerRecordingSnapshot->sprites[i].clear();
+		_pointerRecordingSnapshot->debugRectangles.clear();
+		_currentLayerId = Renderer::LAYER_ID_SCENE;
+		
+		return _pointerRecordingSnapshot;
+	}
+
+	void setLayer(Renderer::LayerId layerId)
+	{
+		assert(layerId < Renderer::LAYER_IDS_COUNT);
+		_currentLayerId = layerId;
+	}
+
+	void addSprite(Texture *pointerTexture, int previousX, int previousY, int x, int y)
+	{
+		Sprite sprite;
+		
+		sprite.pointerSDLTexture = pointerTexture->getSDLTexture();
+		pointerTexture->getDisplayedSourceRectangle(&sprite.sourceRectangle);
+		sprite.previousX = previousX;
+		sprite.previousY = previousY;
+		sprite.x = x;
+		sprite.y = y;
+		_pointerRecordingSnapshot->sprites[_currentLayerId].push_back(sprite);
+	}
+
+	void addDebugRectangle(const SDL_Rect *pointerRectangle, Uint8 red, Uint8 green, Uint8 blue)
+	{
+		DebugRectangle debugRectangle;
+		
+		debugRectangle.rectangle = *pointerRectangle;
+		debugRectangle.color.r = red;
+		debugRectangle.color.g = green;
+		debugRectangle.color.b = blue;
+		debugRectangle.color.a = 255;
+		_pointerRecordingSnapshot->debugRectangles.push_back(debugRectangle);
+	}
+
+	void publishSnapshot()
+	{
+		Snapshot *pointerSnapshot;
+		
+		SDL_LockMutex(_pointerMutex);
+		
+		if (_isLatestSnapshotNew) _transferSnapshotEvents(_pointerLatestSnapshot, _pointerRecordingSnapshot);
+		
+		// The previous latest snapshot is recorded again
+		pointerSnapshot = _pointerLatestSnapshot;
+		_pointerLatestSnapshot = _pointerRecordingSnapshot;
+		_pointerRecordingSnapshot = pointerSnapshot;
+		_isLatestSnapshotNew = true;
+		_isSnapshotPublished = true;
+		
+		SDL_UnlockMutex(_pointerMutex);
+	}
+
+	Snapshot *getLatestSnapshot()
+	{
+		Snapshot *pointerSnapshot;
+		
+		SDL_LockMutex(_pointerMutex);
+		
+		// Keep displaying the same snapshot until a newer one is published
+		if (_isLatestSnapshotNew)
+		{
+			pointerSnapshot = _pointerDisplayedSnapshot;
+			_pointerDisplayedSnapshot = _pointerLatestSnapshot;
+			_pointerLatestSnapshot = pointerSnapshot;
+			_isLatestSnapshotNew = false;
+		}
+		
+		if (_isSnapshotPublished) pointerSnapshot = _pointerDisplayedSnapshot;
+		else pointerSnapshot = NULL;
+		
+		SDL_UnlockMutex(_pointerMutex);
+		
+		return pointerSnapshot;
+	}
+}
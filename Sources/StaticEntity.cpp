@@ -3,8 +3,8 @@
  * @author Adrien RICCIARDI
  */
 #include <cassert>
-#include <Renderer.hpp>
 #include <SDL2/SDL.h>
+#include <SnapshotManager.hpp>
 #include <StaticEntity.hpp>
 
 StaticEntity::StaticEntity(int x, int y, Texture *pointerTexture)
@@ -20,9 +20,10 @@ StaticEntity::StaticEntity(int x, int y, Texture *pointerTexture)
 	_positionRectangle.h = pointerTexture->getHeight();
 }
 
-void StaticEntity::render()
+void StaticEntity::addToSnapshot()
 {
-	_pointerTexture->render(_positionRectangle.x - Renderer::displayX, _positionRectangle.y - Renderer::displayY);
+	// The entity does not move
+	SnapshotManager::addSprite(_pointerTexture, _positionRectangle.x, _positionRectangle.y, _positionRectangle.x, _positionRectangle.y);
 }
 
 int StaticEntity::getX()
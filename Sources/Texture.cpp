@@ -18,6 +18,20 @@ Texture::Texture(SDL_Texture *pointerSDLTexture)
 		LOG_ERROR("Failed to query texture information (%s).", SDL_GetError());
 		exit(-1);
 	}
+	
+	// Display the whole SDL texture
+	_sourceRectangle.x = 0;
+	_sourceRectangle.y = 0;
+	_sourceRectangle.w = _width;
+	_sourceRectangle.h = _height;
+}
+
+Texture::Texture(SDL_Texture *pointerSDLTexture, const SDL_Rect *pointerSourceRectangle)
+{
+	_pointerSDLTexture = pointerSDLTexture;
+	_sourceRectangle = *pointerSourceRectangle;
+	_width = pointerSourceRectangle->w;
+	_height = pointerSourceRectangle->h;
 }
 
 int Texture::render(int x, int y)
@@ -28,8 +42,13 @@ int Texture::render(int x, int y)
 	positionRectangle.w = _width;
 	positionRectangle.h = _height;
 	
-	// Render texture only if it is visible on the screen
-	if ((x + _width >= 0) && (y + _height >= 0) && (x < Renderer::displayWidth) && (y < Renderer::displayHeight)) SDL_RenderCopy(Renderer::pointerRenderer, _pointerSDLTexture, NULL, &positionRectangle);
+	// The renderer discards the texture if it is not visible on the screen
+	Renderer::renderBatchedTexture(_pointerSDLTexture, &_sourceRectangle, &positionRectangle);
 	
 	return 0;
 }
+
+void Texture::getDisplayedSourceRectangle(SDL_Rect *pointerRectangle)
+{
+	*pointerRectangle = _sourceRectangle;
+}
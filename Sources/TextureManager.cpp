@@ -26,7 +26,8 @@ namespace TextureManager
 		const char *pointerStringFileName; //!< The file the texture is loaded from.
 		int imagesCount; //!< How many images are contained in the provided file (in case of an animated texture). Set to 1 if the texture is not animated.
 		int framesPerImageCount; //!< Used only for animated textures. How many game frame to wait before displaying the next image.
-		SDL_Texture *pointerSDLTexture; //!< The SDL texture that can be rendered.
+		SDL_Texture *pointerSDLTexture; //!< The SDL texture that can be rendered, it is shared by all textures packed in the same atlas.
+		SDL_Rect sourceRectangle; //!< The texture location in the SDL texture.
 		Texture *pointerTexture; //!< The game texture representation associated with this image (it can be still or animated).
 	} TextureInformation;
 
@@ -40,6 +41,7 @@ namespace TextureManager
 			1,
 			0,
 			NULL,
+			{0, 0, 0, 0},
 			NULL
 		},
 		// TEXTURE_ID_SCENE_FLOOR_1
@@ -48,6 +50,7 @@ namespace TextureManager
 			1,
 			0,
 			NULL,
+			{0, 0, 0, 0},
 			NULL
 		},
 		// TEXTURE_ID_SCENE_FLOOR_2
@@ -56,6 +59,7 @@ namespace TextureManager
 			1,
 			0,
 			NULL,
+			{0, 0, 0, 0},
 			NULL
 		},
 		// TEXTURE_ID_SCENE_FLOOR_3
@@ -64,6 +68,7 @@ namespace TextureManager
 			1,
 			0,
 			NULL,
+			{0, 0, 0, 0},
 			NULL
 		},
 		// TEXTURE_ID_SCENE_FLOOR_4
@@ -72,6 +77,7 @@ namespace TextureManager
 			1,
 			0,
 			NULL,
+			{0, 0, 0, 0},
 			NULL
 		},
 		// TEXTURE_ID_SCENE_FLOOR_5
@@ -80,6 +86,7 @@ namespace TextureManager
 			1,
 			0,
 			NULL,
+			{0, 0, 0, 0},
 			NULL
 		},
 		// TEXTURE_ID_SCENE_FLOOR_6
@@ -88,6 +95,7 @@ namespace TextureManager
 			1,
 			0,
 			NULL,
+			{0, 0, 0, 0},
 			NULL
 		},
 		// TEXTURE_ID_SCENE_FLOOR_7
@@ -96,6 +104,7 @@ namespace TextureManager
 			1,
 			0,
 			NULL,
+			{0, 0, 0, 0},
 			NULL
 		},
 		// TEXTURE_ID_SCENE_FLOOR_8
@@ -104,6 +113,7 @@ namespace TextureManager
 			1,
 			0,
 			NULL,
+			{0, 0, 0, 0},
 			NULL
 		},
 		// TEXTURE_ID_SCENE_FLOOR_9
@@ -112,6 +122,7 @@ namespace TextureManager
 			1,
 			0,
 			NULL,
+			{0, 0, 0, 0},
 			NULL
 		},
 		// TEXTURE_ID_SCENE_FLOOR_10
@@ -120,6 +131,7 @@ namespace TextureManager
 			1,
 			0,
 			NULL,
+			{0, 0, 0, 0},
 			NULL
 		},
 		// TEXTURE_ID_SCENE_FLOOR_11
@@ -128,6 +140,7 @@ namespace TextureManager
 			1,
 			0,
 			NULL,
+			{0, 0, 0, 0},
 			NULL
 		},
 		// TEXTURE_ID_SCENE_FLOOR_12
@@ -136,6 +149,7 @@ namespace TextureManager
 			1,
 			0,
 			NULL,
+			{0, 0, 0, 0},
 			NULL
 		},
 		// TEXTURE_ID_SCENE_FLOOR_13
@@ -144,6 +158,7 @@ namespace TextureManager
 			1,
 			0,
 			NULL,
+			{0, 0, 0, 0},
 			NULL
 		},
 		// TEXTURE_ID_SCENE_FLOOR_14
@@ -152,6 +167,7 @@ namespace TextureManager
 			1,
 			0,
 			NULL,
+			{0, 0, 0, 0},
 			NULL
 		},
 		// TEXTURE_ID_SCENE_FLOOR_15
@@ -160,6 +176,7 @@ namespace TextureManager
 			1,
 			0,
 			NULL,
+			{0, 0, 0, 0},
 			NULL
 		},
 		// TEXTURE_ID_SCENE_FLOOR_16
@@ -168,6 +185,7 @@ namespace TextureManager
 			1,
 			0,
 			NULL,
+			{0, 0, 0, 0},
 			NULL
 		},
 		
@@ -178,6 +196,7 @@ namespace TextureManager
 			1,
 			0,
 			NULL,
+			{0, 0, 0, 0},
 			NULL
 		},
 		// TEXTURE_ID_SCENE_WALL_1
@@ -186,6 +205,7 @@ namespace TextureManager
 			1,
 			0,
 			NULL,
+			{0, 0, 0, 0},
 			NULL
 		},
 		// TEXTURE_ID_SCENE_WALL_2
@@ -194,6 +214,7 @@ namespace TextureManager
 			1,
 			0,
 			NULL,
+			{0, 0, 0, 0},
 			NULL
 		},
 		// TEXTURE_ID_SCENE_WALL_3
@@ -202,6 +223,7 @@ namespace TextureManager
 			1,
 			0,
 			NULL,
+			{0, 0, 0, 0},
 			NULL
 		},
 		// TEXTURE_ID_SCENE_WALL_4
@@ -210,6 +232,7 @@ namespace TextureManager
 			1,
 			0,
 			NULL,
+			{0, 0, 0, 0},
 			NULL
 		},
 		// TEXTURE_ID_SCENE_WALL_5
@@ -218,6 +241,7 @@ namespace TextureManager
 			1,
 			0,
 			NULL,
+			{0, 0, 0, 0},
 			NULL
 		},
 		// TEXTURE_ID_SCENE_WALL_6
@@ -226,6 +250,7 @@ namespace TextureManager
 			1,
 			0,
 			NULL,
+			{0, 0, 0, 0},
 			NULL
 		},
 		
@@ -236,6 +261,7 @@ namespace TextureManager
 			1,
 			0,
 			NULL,
+			{0, 0, 0, 0},
 			NULL
 		},
 		// TEXTURE_ID_GOLDEN_MEDIPACK
@@ -244,6 +270,7 @@ namespace TextureManager
 			1,
 			0,
 			NULL,
+			{0, 0, 0, 0},
 			NULL
 		},
 		// TEXTURE_ID_AMMUNITION
@@ -252,6 +279,7 @@ namespace TextureManager
 			1,
 			0,
 			NULL,
+			{0, 0, 0, 0},
 			NULL
 		},
 		// TEXTURE_ID_MACHINE_GUN
@@ -260,6 +288,7 @@ namespace TextureManager
 			1,
 			0,
 			NULL,
+			{0, 0, 0, 0},
 			NULL
 		},
 		// TEXTURE_ID_BULLETPROOF_VEST
@@ -268,6 +297,7 @@ namespace TextureManager
 			1,
 			0,
 			NULL,
+			{0, 0, 0, 0},
 			NULL
 		},
 		// TEXTURE_ID_ENEMY_SPAWNER
@@ -276,6 +306,7 @@ namespace TextureManager
 			1,
 			0,
 			NULL,
+			{0, 0, 0, 0},
 			NULL
 		},
 		// TEXTURE_ID_ENEMY_SPAWNER_DAMAGED_1
@@ -284,6 +315,7 @@ namespace TextureManager
 			1,
 			0,
 			NULL,
+			{0, 0, 0, 0},
 			NULL
 		},
 		// TEXTURE_ID_ENEMY_SPAWNER_DAMAGED_2
@@ -292,6 +324,7 @@ namespace TextureManager
 			1,
 			0,
 			NULL,
+			{0, 0, 0, 0},
 			NULL
 		},
 		// TEXTURE_ID_ENEMY_SPAWNER_DAMAGED_3
@@ -300,6 +333,7 @@ namespace TextureManager
 			1,
 			0,
 			NULL,
+			{0, 0, 0, 0},
 			NULL
 		},
 		// TEXTURE_ID_ENEMY_SPAWNER_DAMAGED_4
@@ -308,6 +342,7 @@ namespace TextureManager
 			1,
 			0,
 			NULL,
+			{0, 0, 0, 0},
 			NULL
 		},
 		
@@ -318,6 +353,7 @@ namespace TextureManager
 			1,
 			0,
 			NULL,
+			{0, 0, 0, 0},
 			NULL
 		},
 		// TEXTURE_ID_PLAYER_FACING_DOWN
@@ -326,6 +362,7 @@ namespace TextureManager
 			1,
 			0,
 			NULL,
+			{0, 0, 0, 0},
 			NULL
 		},
 		// TEXTURE_ID_PLAYER_FACING_LEFT
@@ -334,6 +371,7 @@ namespace TextureManager
 			1,
 			0,
 			NULL,
+			{0, 0, 0, 0},
 			NULL
 		},
 		// TEXTURE_ID_PLAYER_FACING_RIGHT
@@ -342,6 +380,7 @@ namespace TextureManager
 			1,
 			0,
 			NULL,
+			{0, 0, 0, 0},
 			NULL
 		},
 		// TEXTURE_ID_PLAYER_BULLETPROOF_VEST_BONUS_FACING_UP
@@ -350,6 +389,7 @@ namespace TextureManager
 			1,
 			0,
 			NULL,
+			{0, 0, 0, 0},
 			NULL
 		},
 		// TEXTURE_ID_PLAYER_BULLETPROOF_VEST_BONUS_FACING_DOWN
@@ -358,6 +398,7 @@ namespace TextureManager
 			1,
 			0,
 			NULL,
+			{0, 0, 0, 0},
 			NULL
 		},
 		// TEXTURE_ID_PLAYER_BULLETPROOF_VEST_BONUS_FACING_LEFT
@@ -366,6 +407,7 @@ namespace TextureManager
 			1,
 			0,
 			NULL,
+			{0, 0, 0, 0},
 			NULL
 		},
 		// TEXTURE_ID_PLAYER_BULLETPROOF_VEST_BONUS_FACING_RIGHT
@@ -374,6 +416,7 @@ namespace TextureManager
 			1,
 			0,
 			NULL,
+			{0, 0, 0, 0},
 			NULL
 		},
 		// TEXTURE_ID_PLAYER_MACHINE_GUN_BONUS_FACING_UP
@@ -382,6 +425,7 @@ namespace TextureManager
 			1,
 			0,
 			NULL,
+			{0, 0, 0, 0},
 			NULL
 		},
 		// TEXTURE_ID_PLAYER_MACHINE_GUN_BONUS_FACING_DOWN
@@ -390,6 +434,7 @@ namespace TextureManager
 			1,
 			0,
 			NULL,
+			{0, 0, 0, 0},
 			NULL
 		},
 		// TEXTURE_ID_PLAYER_MACHINE_GUN_BONUS_FACING_LEFT
@@ -398,6 +443,7 @@ namespace TextureManager
 			1,
 			0,
 			NULL,
+			{0, 0, 0, 0},
 			NULL
 		},
 		// TEXTURE_ID_PLAYER_MACHINE_GUN_BONUS_FACING_RIGHT
@@ -406,6 +452,7 @@ namespace TextureManager
 			1,
 			0,
 			NULL,
+			{0, 0, 0, 0},
 			NULL
 		},
 		// TEXTURE_ID_SMALL_ENEMY_FACING_UP
@@ -414,6 +461,7 @@ namespace TextureManager
 			1,
 			0,
 			NULL,
+			{0, 0, 0, 0},
 			NULL
 		},
 		// TEXTURE_ID_SMALL_ENEMY_FACING_DOWN
@@ -422,6 +470,7 @@ namespace TextureManager
 			1,
 			0,
 			NULL,
+			{0, 0, 0, 0},
 			NULL
 		},
 		// TEXTURE_ID_SMALL_ENEMY_FACING_LEFT
@@ -430,6 +479,7 @@ namespace TextureManager
 			1,
 			0,
 			NULL,
+			{0, 0, 0, 0},
 			NULL
 		},
 		// TEXTURE_ID_SMALL_ENEMY_FACING_RIGHT
@@ -438,6 +488,7 @@ namespace TextureManager
 			1,
 			0,
 			NULL,
+			{0, 0, 0, 0},
 			NULL
 		},
 		// TEXTURE_ID_MEDIUM_ENEMY_FACING_UP
@@ -446,6 +497,7 @@ namespace TextureManager
 			1,
 			0,
 			NULL,
+			{0, 0, 0, 0},
 			NULL
 		},
 		// TEXTURE_ID_MEDIUM_ENEMY_FACING_DOWN
@@ -454,6 +506,7 @@ namespace TextureManager
 			1,
 			0,
 			NULL,
+			{0, 0, 0, 0},
 			NULL
 		},
 		// TEXTURE_ID_MEDIUM_ENEMY_FACING_LEFT
@@ -462,6 +515,7 @@ namespace TextureManager
 			1,
 			0,
 			NULL,
+			{0, 0, 0, 0},
 			NULL
 		},
 		// TEXTURE_ID_MEDIUM_ENEMY_FACING_RIGHT
@@ -470,6 +524,7 @@ namespace TextureManager
 			1,
 			0,
 			NULL,
+			{0, 0, 0, 0},
 			NULL
 		},
 		// TEXTURE_ID_MEDIUM_ENEMY_DAMAGED_1_FACING_UP
@@ -478,6 +533,7 @@ namespace TextureManager
 			1,
 			0,
 			NULL,
+			{0, 0, 0, 0},
 			NULL
 		},
 		// TEXTURE_ID_MEDIUM_ENEMY_DAMAGED_1_FACING_DOWN
@@ -486,6 +542,7 @@ namespace TextureManager
 			1,
 			0,
 			NULL,
+			{0, 0, 0, 0},
 			NULL
 		},
 		// TEXTURE_ID_MEDIUM_ENEMY_DAMAGED_1_FACING_LEFT
@@ -494,6 +551,7 @@ namespace TextureManager
 			1,
 			0,
 			NULL,
+			{0, 0, 0, 0},
 			NULL
 		},
 		// TEXTURE_ID_MEDIUM_ENEMY_DAMAGED_1_FACING_RIGHT
@@ -502,6 +560,7 @@ namespace TextureManager
 			1,
 			0,
 			NULL,
+			{0, 0, 0, 0},
 			NULL
 		},
 		// TEXTURE_ID_MEDIUM_ENEMY_DAMAGED_2_FACING_UP
@@ -510,6 +569,7 @@ namespace TextureManager
 			1,
 			0,
 			NULL,
+			{0, 0, 0, 0},
 			NULL
 		},
 		// TEXTURE_ID_MEDIUM_ENEMY_DAMAGED_2_FACING_DOWN
@@ -518,6 +578,7 @@ namespace TextureManager
 			1,
 			0,
 			NULL,
+			{0, 0, 0, 0},
 			NULL
 		},
 		// TEXTURE_ID_MEDIUM_ENEMY_DAMAGED_2_FACING_LEFT
@@ -526,6 +587,7 @@ namespace TextureManager
 			1,
 			0,
 			NULL,
+			{0, 0, 0, 0},
 			NULL
 		},
 		// TEXTURE_ID_MEDIUM_ENEMY_DAMAGED_2_FACING_RIGHT
@@ -534,6 +596,7 @@ namespace TextureManager
 			1,
 			0,
 			NULL,
+			{0, 0, 0, 0},
 			NULL
 		},
 		// TEXTURE_ID_BIG_ENEMY_FACING_UP
@@ -542,6 +605,7 @@ namespace TextureManager
 			1,
 			0,
 			NULL,
+			{0, 0, 0, 0},
 			NULL
 		},
 		// TEXTURE_ID_BIG_ENEMY_FACING_DOWN
@@ -550,6 +614,7 @@ namespace TextureManager
 			1,
 			0,
 			NULL,
+			{0, 0, 0, 0},
 			NULL
 		},
 		// TEXTURE_ID_BIG_ENEMY_FACING_LEFT
@@ -558,6 +623,7 @@ namespace TextureManager
 			1,
 			0,
 			NULL,
+			{0, 0, 0, 0},
 			NULL
 		},
 		// TEXTURE_ID_BIG_ENEMY_FACING_RIGHT
@@ -566,6 +632,7 @@ namespace TextureManager
 			1,
 			0,
 			NULL,
+			{0, 0, 0, 0},
 			NULL
 		},
 		// TEXTURE_ID_BIG_ENEMY_DAMAGED_1_FACING_UP
@@ -574,6 +641,7 @@ namespace TextureManager
 			1,
 			0,
 			NULL,
+			{0, 0, 0, 0},
 			NULL
 		},
 		// TEXTURE_ID_BIG_ENEMY_DAMAGED_1_FACING_DOWN
@@ -582,6 +650,7 @@ namespace TextureManager
 			1,
 			0,
 			NULL,
+			{0, 0, 0, 0},
 			NULL
 		},
 		// TEXTURE_ID_BIG_ENEMY_DAMAGED_1_FACING_LEFT
@@ -590,6 +659,7 @@ namespace TextureManager
 			1,
 			0,
 			NULL,
+			{0, 0, 0, 0},
 			NULL
 		},
 		// TEXTURE_ID_BIG_ENEMY_DAMAGED_1_FACING_RIGHT
@@ -598,6 +668,7 @@ namespace TextureManager
 			1,
 			0,
 			NULL,
+			{0, 0, 0, 0},
 			NULL
 		},
 		// TEXTURE_ID_BIG_ENEMY_DAMAGED_2_FACING_UP
@@ -606,6 +677,7 @@ namespace TextureManager
 			1,
 			0,
 			NULL,
+			{0, 0, 0, 0},
 			NULL
 		},
 		// TEXTURE_ID_BIG_ENEMY_DAMAGED_2_FACING_DOWN
@@ -614,6 +686,7 @@ namespace TextureManager
 			1,
 			0,
 			NULL,
+			{0, 0, 0, 0},
 			NULL
 		},
 		// TEXTURE_ID_BIG_ENEMY_DAMAGED_2_FACING_LEFT
@@ -622,6 +695,7 @@ namespace TextureManager
 			1,
 			0,
 			NULL,
+			{0, 0, 0, 0},
 			NULL
 		},
 		// TEXTURE_ID_BIG_ENEMY_DAMAGED_2_FACING_RIGHT
@@ -630,6 +704,7 @@ namespace TextureManager
 			1,
 			0,
 			NULL,
+			{0, 0, 0, 0},
 			NULL
 		},
 		// TEXTURE_ID_BIG_ENEMY_DAMAGED_3_FACING_UP
@@ -638,6 +713,7 @@ namespace TextureManager
 			1,
 			0,
 			NULL,
+			{0, 0, 0, 0},
 			NULL
 		},
 		// TEXTURE_ID_BIG_ENEMY_DAMAGED_3_FACING_DOWN
@@ -646,6 +722,7 @@ namespace TextureManager
 			1,
 			0,
 			NULL,
+			{0, 0, 0, 0},
 			NULL
 		},
 		// TEXTURE_ID_BIG_ENEMY_DAMAGED_3_FACING_LEFT
@@ -654,6 +731,7 @@ namespace TextureManager
 			1,
 			0,
 			NULL,
+			{0, 0, 0, 0},
 			NULL
 		},
 		// TEXTURE_ID_BIG_ENEMY_DAMAGED_3_FACING_RIGHT
@@ -662,6 +740,7 @@ namespace TextureManager
 			1,
 			0,
 			NULL,
+			{0, 0, 0, 0},
 			NULL
 		},
 		// TEXTURE_ID_BIG_ENEMY_DAMAGED_4_FACING_UP
@@ -670,6 +749,7 @@ namespace TextureManager
 			1,
 			0,
 			NULL,
+			{0, 0, 0, 0},
 			NULL
 		},
 		// TEXTURE_ID_BIG_ENEMY_DAMAGED_4_FACING_DOWN
@@ -678,6 +758,7 @@ namespace TextureManager
 			1,
 			0,
 			NULL,
+			{0, 0, 0, 0},
 			NULL
 		},
 		// TEXTURE_ID_BIG_ENEMY_DAMAGED_4_FACING_LEFT
@@ -686,6 +767,7 @@ namespace TextureManager
 			1,
 			0,
 			NULL,
+			{0, 0, 0, 0},
 			NULL
 		},
 		// TEXTURE_ID_BIG_ENEMY_DAMAGED_4_FACING_RIGHT
@@ -694,6 +776,7 @@ namespace TextureManager
 			1,
 			0,
 			NULL,
+			{0, 0, 0, 0},
 			NULL
 		},
 		// TEXTURE_ID_PLAYER_BULLET_FACING_UP
@@ -702,6 +785,7 @@ namespace TextureManager
 			1,
 			0,
 			NULL,
+			{0, 0, 0, 0},
 			NULL
 		},
 		// TEXTURE_ID_PLAYER_BULLET_FACING_DOWN
@@ -710,6 +794,7 @@ namespace TextureManager
 			1,
 			0,
 			NULL,
+			{0, 0, 0, 0},
 			NULL
 		},
 		// TEXTURE_ID_PLAYER_BULLET_FACING_LEFT
@@ -718,6 +803,7 @@ namespace TextureManager
 			1,
 			0,
 			NULL,
+			{0, 0, 0, 0},
 			NULL
 		},
 		// TEXTURE_ID_PLAYER_BULLET_FACING_RIGHT
@@ -726,6 +812,7 @@ namespace TextureManager
 			1,
 			0,
 			NULL,
+			{0, 0, 0, 0},
 			NULL
 		},
 		// TEXTURE_ID_PLAYER_BULLET_MORTAR_SHELL_FACING_UP
@@ -734,6 +821,7 @@ namespace TextureManager
 			1,
 			0,
 			NULL,
+			{0, 0, 0, 0},
 			NULL
 		},
 		// TEXTURE_ID_PLAYER_BULLET_MORTAR_SHELL_FACING_DOWN
@@ -742,6 +830,7 @@ namespace TextureManager
 			1,
 			0,
 			NULL,
+			{0, 0, 0, 0},
 			NULL
 		},
 		// TEXTURE_ID_PLAYER_BULLET_MORTAR_SHELL_FACING_LEFT
@@ -750,6 +839,7 @@ namespace TextureManager
 			1,
 			0,
 			NULL,
+			{0, 0, 0, 0},
 			NULL
 		},
 		// TEXTURE_ID_PLAYER_BULLET_MORTAR_SHELL_FACING_RIGHT
@@ -758,6 +848,7 @@ namespace TextureManager
 			1,
 			0,
 			NULL,
+			{0, 0, 0, 0},
 			NULL
 		},
 		// TEXTURE_ID_SMALL_ENEMY_BULLET_FACING_UP
@@ -766,6 +857,7 @@ namespace TextureManager
 			1,
 			4,
 			NULL,
+			{0, 0, 0, 0},
 			NULL
 		},
 		// TEXTURE_ID_SMALL_ENEMY_BULLET_FACING_DOWN
@@ -774,6 +866,7 @@ namespace TextureManager
 			1,
 			4,
 			NULL,
+			{0, 0, 0, 0},
 			NULL
 		},
 		// TEXTURE_ID_SMALL_ENEMY_BULLET_FACING_LEFT
@@ -782,6 +875,7 @@ namespace TextureManager
 			1,
 			4,
 			NULL,
+			{0, 0, 0, 0},
 			NULL
 		},
 		// TEXTURE_ID_SMALL_ENEMY_BULLET_FACING_RIGHT
@@ -790,6 +884,7 @@ namespace TextureManager
 			1,
 			4,
 			NULL,
+			{0, 0, 0, 0},
 			NULL
 		},
 		// TEXTURE_ID_MEDIUM_ENEMY_BULLET_FACING_UP
@@ -798,6 +893,7 @@ namespace TextureManager
 			1,
 			0,
 			NULL,
+			{0, 0, 0, 0},
 			NULL
 		},
 		// TEXTURE_ID_MEDIUM_ENEMY_BULLET_FACING_DOWN
@@ -806,6 +902,7 @@ namespace TextureManager
 			1,
 			0,
 			NULL,
+			{0, 0, 0, 0},
 			NULL
 		},
 		// TEXTURE_ID_MEDIUM_ENEMY_BULLET_FACING_LEFT
@@ -814,6 +911,7 @@ namespace TextureManager
 			1,
 			0,
 			NULL,
+			{0, 0, 0, 0},
 			NULL
 		},
 		// TEXTURE_ID_MEDIUM_ENEMY_BULLET_FACING_RIGHT
@@ -822,6 +920,7 @@ namespace TextureManager
 			1,
 			0,
 			NULL,
+			{0, 0, 0, 0},
 			NULL
 		},
 		// TEXTURE_ID_BIG_ENEMY_BULLET_FACING_UP
@@ -830,6 +929,7 @@ namespace TextureManager
 			1,
 			0,
 			NULL,
+			{0, 0, 0, 0},
 			NULL
 		},
 		// TEXTURE_ID_BIG_ENEMY_BULLET_FACING_DOWN
@@ -838,6 +938,7 @@ namespace TextureManager
 			1,
 			0,
 			NULL,
+			{0, 0, 0, 0},
 			NULL
 		},
 		// TEXTURE_ID_BIG_ENEMY_BULLET_FACING_LEFT
@@ -846,6 +947,7 @@ namespace TextureManager
 			1,
 			0,
 			NULL,
+			{0, 0, 0, 0},
 			NULL
 		},
 		// TEXTURE_ID_BIG_ENEMY_BULLET_FACING_RIGHT
@@ -854,6 +956,7 @@ namespace TextureManager
 			1,
 			0,
 			NULL,
+			{0, 0, 0, 0},
 			NULL
 		},
 		
@@ -864,6 +967,7 @@ namespace TextureManager
 			1,
 			0,
 			NULL,
+			{0, 0, 0, 0},
 			NULL
 		},
 		
@@ -874,6 +978,7 @@ namespace TextureManager
 			1,
 			0,
 			NULL,
+			{0, 0, 0, 0},
 			NULL
 		},
 		// TEXTURE_ID_MENU_BACKGROUND
@@ -882,6 +987,7 @@ namespace TextureManager
 			1,
 			0,
 			NULL,
+			{0, 0, 0, 0},
 			NULL
 		},
 		// TEXTURE_ID_COMPASS_ARROW_UP_TURNED_OFF
@@ -890,6 +996,7 @@ namespace TextureManager
 			1,
 			0,
 			NULL,
+			{0, 0, 0, 0},
 			NULL
 		},
 		// TEXTURE_ID_COMPASS_ARROW_DOWN_TURNED_OFF
@@ -898,6 +1005,7 @@ namespace TextureManager
 			1,
 			0,
 			NULL,
+			{0, 0, 0, 0},
 			NULL
 		},
 		// TEXTURE_ID_COMPASS_ARROW_LEFT_TURNED_OFF
@@ -906,6 +1014,7 @@ namespace TextureManager
 			1,
 			0,
 			NULL,
+			{0, 0, 0, 0},
 			NULL
 		},
 		// TEXTURE_ID_COMPASS_ARROW_RIGHT_TURNED_OFF
@@ -914,6 +1023,7 @@ namespace TextureManager
 			1,
 			0,
 			NULL,
+			{0, 0, 0, 0},
 			NULL
 		},
 		// TEXTURE_ID_COMPASS_ARROW_UP_LIGHTED
@@ -922,6 +1032,7 @@ namespace TextureManager
 			1,
 			0,
 			NULL,
+			{0, 0, 0, 0},
 			NULL
 		},
 		// TEXTURE_ID_COMPASS_ARROW_DOWN_LIGHTED
@@ -930,6 +1041,7 @@ namespace TextureManager
 			1,
 			0,
 			NULL,
+			{0, 0, 0, 0},
 			NULL
 		},
 		// TEXTURE_ID_COMPASS_ARROW_LEFT_LIGHTED
@@ -938,6 +1050,7 @@ namespace TextureManager
 			1,
 			0,
 			NULL,
+			{0, 0, 0, 0},
 			NULL
 		},
 		// TEXTURE_ID_COMPASS_ARROW_RIGHT_LIGHTED
@@ -946,6 +1059,7 @@ namespace TextureManager
 			1,
 			0,
 			NULL,
+			{0, 0, 0, 0},
 			NULL
 		},
 		
@@ -956,6 +1070,7 @@ namespace TextureManager
 			32,
 			4,
 			NULL,
+			{0, 0, 0, 0},
 			NULL
 		},
 		// TEXTURE_ID_SMALL_ENEMY_EXPLOSION
@@ -964,6 +1079,7 @@ namespace TextureManager
 			32,
 			4,
 			NULL,
+			{0, 0, 0, 0},
 			NULL
 		},
 		// TEXTURE_ID_MEDIUM_ENEMY_EXPLOSION
@@ -972,6 +1088,7 @@ namespace TextureManager
 			32,
 			4,
 			NULL,
+			{0, 0, 0, 0},
 			NULL
 		},
 		// TEXTURE_ID_BIG_ENEMY_EXPLOSION
@@ -980,6 +1097,7 @@ namespace TextureManager
 			32,
 			4,
 			NULL,
+			{0, 0, 0, 0},
 			NULL
 		},
 		// TEXTURE_ID_BULLET_EXPLOSION
@@ -988,6 +1106,7 @@ namespace TextureManager
 			3,
 			4,
 			NULL,
+			{0, 0, 0, 0},
 			NULL
 		},
 		// TEXTURE_ID_PLAYER_MUZZLE_FLASH_FACING_UP
@@ -996,6 +1115,7 @@ namespace TextureManager
 			1,
 			4,
 			NULL,
+			{0, 0, 0, 0},
 			NULL
 		},
 		// TEXTURE_ID_PLAYER_MUZZLE_FLASH_FACING_DOWN
@@ -1004,6 +1124,7 @@ namespace TextureManager
 			1,
 			4,
 			NULL,
+			{0, 0, 0, 0},
 			NULL
 		},
 		// TEXTURE_ID_PLAYER_MUZZLE_FLASH_FACING_LEFT
@@ -1012,6 +1133,7 @@ namespace TextureManager
 			1,
 			4,
 			NULL,
+			{0, 0, 0, 0},
 			NULL
 		},
 		// TEXTURE_ID_PLAYER_MUZZLE_FLASH_FACING_RIGHT
@@ -1020,6 +1142,7 @@ namespace TextureManager
 			1,
 			4,
 			NULL,
+			{0, 0, 0, 0},
 			NULL
 		},
 		// TEXTURE_ID_SMALL_ENEMY_MUZZLE_FLASH_FACING_UP
@@ -1028,6 +1151,7 @@ namespace TextureManager
 			1,
 			4,
 			NULL,
+			{0, 0, 0, 0},
 			NULL
 		},
 		// TEXTURE_ID_SMALL_ENEMY_MUZZLE_FLASH_FACING_DOWN
@@ -1036,6 +1160,7 @@ namespace TextureManager
 			1,
 			4,
 			NULL,
+			{0, 0, 0, 0},
 			NULL
 		},
 		// TEXTURE_ID_SMALL_ENEMY_MUZZLE_FLASH_FACING_LEFT
@@ -1044,6 +1169,7 @@ namespace TextureManager
 			1,
 			4,
 			NULL,
+			{0, 0, 0, 0},
 			NULL
 		},
 		// TEXTURE_ID_SMALL_ENEMY_MUZZLE_FLASH_FACING_RIGHT
@@ -1052,6 +1178,7 @@ namespace TextureManager
 			1,
 			4,
 			NULL,
+			{0, 0, 0, 0},
 			NULL
 		},
 		// TEXTURE_ID_MEDIUM_ENEMY_MUZZLE_FLASH_FACING_UP
@@ -1060,6 +1187,7 @@ namespace TextureManager
 			1,
 			6,
 			NULL,
+			{0, 0, 0, 0},
 			NULL
 		},
 		// TEXTURE_ID_MEDIUM_ENEMY_MUZZLE_FLASH_FACING_DOWN
@@ -1068,6 +1196,7 @@ namespace TextureManager
 			1,
 			6,
 			NULL,
+			{0, 0, 0, 0},
 			NULL
 		},
 		// TEXTURE_ID_MEDIUM_ENEMY_MUZZLE_FLASH_FACING_LEFT
@@ -1076,6 +1205,7 @@ namespace TextureManager
 			1,
 			6,
 			NULL,
+			{0, 0, 0, 0},
 			NULL
 		},
 		// TEXTURE_ID_MEDIUM_ENEMY_MUZZLE_FLASH_FACING_RIGHT
@@ -1084,6 +1214,7 @@ namespace TextureManager
 			1,
 			6,
 			NULL,
+			{0, 0, 0, 0},
 			NULL
 		},
 		// TEXTURE_ID_BIG_ENEMY_MUZZLE_FLASH_FACING_UP
@@ -1092,6 +1223,7 @@ namespace TextureManager
 			1,
 			8,
 			NULL,
+			{0, 0, 0, 0},
 			NULL
 		},
 		// TEXTURE_ID_BIG_ENEMY_MUZZLE_FLASH_FACING_DOWN
@@ -1100,6 +1232,7 @@ namespace TextureManager
 			1,
 			8,
 			NULL,
+			{0, 0, 0, 0},
 			NULL
 		},
 		// TEXTURE_ID_BIG_ENEMY_MUZZLE_FLASH_FACING_LEFT
@@ -1108,6 +1241,7 @@ namespace TextureManager
 			1,
 			8,
 			NULL,
+			{0, 0, 0, 0},
 			NULL
 		},
 		// TEXTURE_ID_BIG_ENEMY_MUZZLE_FLASH_FACING_RIGHT
@@ -1116,6 +1250,7 @@ namespace TextureManager
 			1,
 			8,
 			NULL,
+			{0, 0, 0, 0},
 			NULL
 		},
 		// TEXTURE_ID_PLAYER_MUZZLE_FLASH_MORTAR_SHELL
@@ -1124,6 +1259,7 @@ namespace TextureManager
 			6,
 			4,
 			NULL,
+			{0, 0, 0, 0},
 			NULL
 		},
 		// TEXTURE_ID_MEDIPACK_TAKEN
@@ -1132,6 +1268,7 @@ namespace TextureManager
 			7,
 			6,
 			NULL,
+			{0, 0, 0, 0},
 			NULL
 		},
 		// TEXTURE_ID_GOLDEN_MEDIPACK_TAKEN
@@ -1140,6 +1277,7 @@ namespace TextureManager
 			7,
 			6,
 			NULL,
+			{0, 0, 0, 0},
 			NULL
 		},
 		// TEXTURE_ID_AMMUNITION_TAKEN
@@ -1148,6 +1286,7 @@ namespace TextureManager
 			3,
 			6,
 			NULL,
+			{0, 0, 0, 0},
 			NULL
 		},
 		// TEXTURE_ID_ENEMY_SPAWNER_TELEPORTATION_EFFECT
@@ -1156,6 +1295,7 @@ namespace TextureManager
 			8,
 			16,
 			NULL,
+			{0, 0, 0, 0},
 			NULL
 		},
 		// TEXTURE_ID_MACHINE_GUN_TAKEN
@@ -1164,6 +1304,7 @@ namespace TextureManager
 			8,
 			8,
 			NULL,
+			{0, 0, 0, 0},
 			NULL
 		},
 		// TEXTURE_ID_BULLETPROOF_VEST_TAKEN
@@ -1172,51 +1313,211 @@ namespace TextureManager
 			8,
 			8,
 			NULL,
+			{0, 0, 0, 0},
 			NULL
 		}
 	};
 
+	/** All SDL textures (atlases and textures too big to be packed), so they can be freed. */
+	static SDL_Texture *_pointerSDLTextures[TEXTURE_IDS_COUNT];
+	/** How many SDL textures have been created. */
+	static int _sdlTexturesCount = 0;
+
+	/** Convert a surface to a SDL texture that will be freed when the texture manager is uninitialized.
+	 * @param pointerSurface The surface to convert.
+	 * @return NULL if an error occurred,
+	 * @return the SDL texture on success.
+	 */
+	static SDL_Texture *_createSDLTexture(SDL_Surface *pointerSurface)
+	{
+		SDL_Texture *pointerSDLTexture;
+		
+		pointerSDLTexture = SDL_CreateTextureFromSurface(Renderer::pointerRenderer, pointerSurface);
+		if (pointerSDLTexture == NULL)
+		{
+			LOG_ERROR("Failed to convert the surface to a texture (%s).", SDL_GetError());
+			return NULL;
+		}
+		
+		_pointerSDLTextures[_sdlTexturesCount] = pointerSDLTexture;
+		_sdlTexturesCount++;
+		return pointerSDLTexture;
+	}
+
+	/** Copy all surfaces located in an atlas to a single texture.
+	 * @param pointerSurfaces All textures surfaces.
+	 * @param atlasIndexes The atlas each texture is located in (-1 if the texture is not in an atlas).
+	 * @param atlasIndex The atlas to create.
+	 * @param width The atlas width in pixels.
+	 * @param height The atlas height in pixels.
+	 * @return -1 if an error occurred,
+	 * @return 0 on success.
+	 */
+	static int _createAtlas(SDL_Surface *pointerSurfaces[], const int atlasIndexes[], int atlasIndex, int width, int height)
+	{
+		SDL_Surface *pointerAtlasSurface;
+		SDL_Texture *pointerSDLTexture;
+		SDL_Rect destinationRectangle;
+		int i, xOffset, yOffset;
+		
+		// All pixels are transparent by default
+		pointerAtlasSurface = SDL_CreateRGBSurfaceWithFormat(0, width, height, 32, SDL_PIXELFORMAT_ARGB8888);
+		if (pointerAtlasSurface == NULL)
+		{
+			LOG_ERROR("Failed to create the texture atlas %d surface (%s).", atlasIndex, SDL_GetError());
+			return -1;
+		}
+		
+		for (i = 0; i < TEXTURE_IDS_COUNT; i++)
+		{
+			if (atlasIndexes[i] != atlasIndex) continue;
+			
+			// Copy the pixels alpha as-is instead of blending them with the atlas
+			SDL_SetSurfaceBlendMode(pointerSurfaces[i], SDL_BLENDMODE_NONE);
+			
+			// Extend the picture borders by one pixel, so the neighbor textures are never sampled when the picture is scaled
+			for (yOffset = -1; yOffset <= 1; yOffset++)
+			{
+				for (xOffset = -1; xOffset <= 1; xOffset++)
+				{
+					if ((xOffset == 0) && (yOffset == 0)) continue;
+					destinationRectangle = _texturesInformations[i].sourceRectangle;
+					destinationRectangle.x += xOffset;
+					destinationRectangle.y += yOffset;
+					SDL_BlitSurface(pointerSurfaces[i], NULL, pointerAtlasSurface, &destinationRectangle);
+				}
+			}
+			destinationRectangle = _texturesInformations[i].sourceRectangle;
+			if (SDL_BlitSurface(pointerSurfaces[i], NULL, pointerAtlasSurface, &destinationRectangle) != 0)
+			{
+				LOG_ERROR("Failed to copy texture '%s' to the texture atlas %d (%s).", _texturesInformations[i].pointerStringFileName, atlasIndex, SDL_GetError());
+				SDL_FreeSurface(pointerAtlasSurface);
+				return -1;
+			}
+		}
+		
+		pointerSDLTexture = _createSDLTexture(pointerAtlasSurface);
+		SDL_FreeSurface(pointerAtlasSurface);
+		if (pointerSDLTexture == NULL) return -1;
+		
+		for (i = 0; i < TEXTURE_IDS_COUNT; i++)
+		{
+			if (atlasIndexes[i] == atlasIndex) _texturesInformations[i].pointerSDLTexture = pointerSDLTexture;
+		}
+		LOG_DEBUG("Created texture atlas %d (%dx%d pixels).", atlasIndex, width, height);
+		return 0;
+	}
+
 	int initialize()
 	{
+		SDL_Surface *pointerSurfaces[TEXTURE_IDS_COUNT] = {0};
+		int atlasIndexes[TEXTURE_IDS_COUNT], sortedIds[TEXTURE_IDS_COUNT];
+		int i, j, id, atlasSize, atlasIndex = 0, shelfX = 0, shelfY = 0, shelfHeight = 0, paddedWidth, paddedHeight, returnValue = -1;
+		SDL_RendererInfo rendererInformation;
+		
 		// Load all files
-		SDL_Surface *pointerSurface;
-		for (int i = 0; i < TEXTURE_IDS_COUNT; i++)
+		for (i = 0; i < TEXTURE_IDS_COUNT; i++)
 		{
 			// Try to load bitmap
-			pointerSurface = IMG_Load(_texturesInformations[i].pointerStringFileName);
-			if (pointerSurface == NULL)
+			pointerSurfaces[i] = IMG_Load(_texturesInformations[i].pointerStringFileName);
+			if (pointerSurfaces[i] == NULL)
 			{
 				LOG_ERROR("Failed to load texture '%s' (%s).", _texturesInformations[i].pointerStringFileName, SDL_GetError());
-				return -1;
+				goto Exit;
 			}
 			
-			// Convert the surface to a texture
-			_texturesInformations[i].pointerSDLTexture = SDL_CreateTextureFromSurface(Renderer::pointerRenderer, pointerSurface);
-			SDL_FreeSurface(pointerSurface);
-			if (_texturesInformations[i].pointerSDLTexture == NULL)
+			_texturesInformations[i].sourceRectangle.w = pointerSurfaces[i]->w;
+			_texturesInformations[i].sourceRectangle.h = pointerSurfaces[i]->h;
+			atlasIndexes[i] = -1;
+			sortedIds[i] = i;
+		}
+		
+		// Atlases can't be bigger than what the renderer supports
+		atlasSize = CONFIGURATION_DISPLAY_TEXTURE_ATLAS_SIZE;
+		if (SDL_GetRendererInfo(Renderer::pointerRenderer, &rendererInformation) == 0)
+		{
+			if ((rendererInformation.max_texture_width > 0) && (rendererInformation.max_texture_width < atlasSize)) atlasSize = rendererInformation.max_texture_width;
+			if ((rendererInformation.max_texture_height > 0) && (rendererInformation.max_texture_height < atlasSize)) atlasSize = rendererInformation.max_texture_height;
+		}
+		
+		// Pack the textures in rows ("shelves"), starting with the tallest textures so each row wastes as few space as possible (a simple insertion sort is enough for this amount of textures)
+		for (i = 1; i < TEXTURE_IDS_COUNT; i++)
+		{
+			id = sortedIds[i];
+			for (j = i; (j > 0) && (_texturesInformations[sortedIds[j - 1]].sourceRectangle.h < _texturesInformations[id].sourceRectangle.h); j--) sortedIds[j] = sortedIds[j - 1];
+			sortedIds[j] = id;
+		}
+		for (i = 0; i < TEXTURE_IDS_COUNT; i++)
+		{
+			id = sortedIds[i];
+			
+			// Keep a one pixel border around each texture
+			paddedWidth = _texturesInformations[id].sourceRectangle.w + 2;
+			paddedHeight = _texturesInformations[id].sourceRectangle.h + 2;
+			
+			// Textures that are too big are not packed
+			if ((paddedWidth > atlasSize) || (paddedHeight > atlasSize)) continue;
+			
+			// Start a new row if the current one is full
+			if (shelfX + paddedWidth > atlasSize)
 			{
-				LOG_ERROR("Failed to convert the surface to a texture (%s).", SDL_GetError());
-				return -1;
+				shelfY += shelfHeight;
+				shelfX = 0;
+				shelfHeight = 0;
+			}
+			// Start a new atlas if the current one is full
+			if (shelfY + paddedHeight > atlasSize)
+			{
+				if (_createAtlas(pointerSurfaces, atlasIndexes, atlasIndex, atlasSize, atlasSize) != 0) goto Exit;
+				atlasIndex++;
+				shelfX = 0;
+				shelfY = 0;
+				shelfHeight = 0;
+			}
+			
+			atlasIndexes[id] = atlasIndex;
+			_texturesInformations[id].sourceRectangle.x = shelfX + 1;
+			_texturesInformations[id].sourceRectangle.y = shelfY + 1;
+			shelfX += paddedWidth;
+			if (paddedHeight > shelfHeight) shelfHeight = paddedHeight;
+		}
+		// The last atlas is only as tall as needed
+		if (_createAtlas(pointerSurfaces, atlasIndexes, atlasIndex, atlasSize, shelfY + shelfHeight) != 0) goto Exit;
+		
+		// Create the game textures
+		for (i = 0; i < TEXTURE_IDS_COUNT; i++)
+		{
+			// Textures that are not packed keep their own SDL texture
+			if (atlasIndexes[i] < 0)
+			{
+				_texturesInformations[i].pointerSDLTexture = _createSDLTexture(pointerSurfaces[i]);
+				if (_texturesInformations[i].pointerSDLTexture == NULL) goto Exit;
+				LOG_DEBUG("Texture '%s' is too big to be packed in a texture atlas.", _texturesInformations[i].pointerStringFileName);
 			}
 			
 			// Create the associated game texture (TODO even for animated textures ?)
-			_texturesInformations[i].pointerTexture = new Texture(_texturesInformations[i].pointerSDLTexture);
+			_texturesInformations[i].pointerTexture = new Texture(_texturesInformations[i].pointerSDLTexture, &_texturesInformations[i].sourceRectangle);
 			
 			LOG_DEBUG("Loaded texture. File name : %s, texture ID : %d, SDL texture pointer : %p.", _texturesInformations[i].pointerStringFileName, i, _texturesInformations[i].pointerSDLTexture);
 		}
-		LOG_DEBUG("Loaded %d textures.", TEXTURE_IDS_COUNT);
+		LOG_DEBUG("Loaded %d textures into %d SDL textures.", TEXTURE_IDS_COUNT, _sdlTexturesCount);
+		returnValue = 0;
 		
-		return 0;
+	Exit:
+		for (i = 0; i < TEXTURE_IDS_COUNT; i++)
+		{
+			if (pointerSurfaces[i] != NULL) SDL_FreeSurface(pointerSurfaces[i]);
+		}
+		return returnValue;
 	}
 
 	void uninitialize()
 	{
+		int i;
+		
 		// Free all textures
-		for (int i = 0; i < TEXTURE_IDS_COUNT; i++)
-		{
-			delete _texturesInformations[i].pointerTexture;
-			SDL_DestroyTexture(_texturesInformations[i].pointerSDLTexture);
-		}
+		for (i = 0; i < TEXTURE_IDS_COUNT; i++) delete _texturesInformations[i].pointerTexture;
+		for (i = 0; i < _sdlTexturesCount; i++) SDL_DestroyTexture(_pointerSDLTextures[i]);
 	}
 
 	Texture *getTextureFromId(TextureId id)
@@ -1232,6 +1533,6 @@ namespace TextureManager
 		// Make sure the provided ID is valid
 		assert(id < TEXTURE_IDS_COUNT);
 		
-		return new AnimatedTexture(_texturesInformations[id].pointerSDLTexture, _texturesInformations[id].imagesCount, _texturesInformations[id].framesPerImageCount, isAnimationLooping);
+		return new AnimatedTexture(_texturesInformations[id].pointerSDLTexture, &_texturesInformations[id].sourceRectangle, _texturesInformations[id].imagesCount, _texturesInformations[id].framesPerImageCount, isAnimationLooping);
 	}
 }
@@ -0,0 +1,22 @@
+/** @file TimeManager.cpp
+ * See TimeManager.hpp for description.
+ * @author Adrien RICCIARDI
+ */
+#include <Configuration.hpp>
+#include <TimeManager.hpp>
+
+namespace TimeManager
+{
+	/** The simulated time in milliseconds. */
+	static unsigned int _ticks = 0;
+
+	unsigned int getTicks()
+	{
+		return _ticks;
+	}
+
+	void tick()
+	{
+		_ticks += CONFIGURATION_GAMEPLAY_TICK_PERIOD_MILLISECONDS;
+	}
+}
@@ -0,0 +1,139 @@
+/** @file WorkerPool.cpp
+ * See WorkerPool.hpp for description.
+ * @author Adrien RICCIARDI
+ */
+#include <Configuration.hpp>
+#include <Log.hpp>
+#include <SDL2/SDL.h>
+#include <WorkerPool.hpp>
+
+namespace WorkerPool
+{
+	/** All started worker threads. */
+	static SDL_Thread *_pointerThreads[CONFIGURATION_WORKER_POOL_MAXIMUM_THREADS_COUNT];
+	/** How many worker threads are started. */
+	static int _threadsCount = 0;
+
+	/** Posted once for each worker thread when a parallel loop starts. */
+	static SDL_sem *_pointerLoopStartedSemaphore = NULL;
+	/** Posted by each worker thread when it finished processing the loop items. */
+	static SDL_sem *_pointerLoopFinishedSemaphore = NULL;
+
+	/** The function the running loop calls for each item. */
+	static void (*_pointerLoopFunction)(int itemIndex);
+	/** How many items the running loop contains. */
+	static int _loopItemsCount;
+	/** The first item no thread has taken yet. */
+	static SDL_atomic_t _nextLoopItemIndex;
+
+	/** Tell the worker threads to exit instead of processing a loop. */
+	static bool _isWorkerPoolStopped = false;
+
+	/** Take chunks of items from the running loop and process them, until all items have been taken. */
+	static void _processLoopItems()
+	{
+		int i, firstItemIndex, endItemIndex;
+		
+		while (1)
+		{
+			firstItemIndex = SDL_AtomicAdd(&_nextLoopItemIndex, CONFIGURATION_WORKER_POOL_ITEMS_CHUNK_SIZE);
+			if (firstItemIndex >= _loopItemsCount) return;
+			
+			endItemIndex = firstItemIndex + CONFIGURATION_WORKER_POOL_ITEMS_CHUNK_SIZE;
+			if (endItemIndex > _loopItemsCount) endItemIndex = _loopItemsCount;
+			for (i = firstItemIndex; i < endItemIndex; i++) _pointerLoopFunction(i);
+		}
+	}
+
+	/** A worker thread, it processes the items of each started loop.
+	 * @return Always 0.
+	 */
+	static int _workerThread(void *)
+	{
+		while (1)
+		{
+			// The semaphores make the loop parameters written by the calling thread visible to this thread
+			SDL_SemWait(_pointerLoopStartedSemaphore);
+			if (_isWorkerPoolStopped) break;
+			
+			_processLoopItems();
+			SDL_SemPost(_pointerLoopFinishedSemaphore);
+		}
+		
+		return 0;
+	}
+
+	int initialize()
+	{
+		int threadsCount;
+		
+		_pointerLoopStartedSemaphore = SDL_CreateSemaphore(0);
+		_pointerLoopFinishedSemaphore = SDL_CreateSemaphore(0);
+		if ((_pointerLoopStartedSemaphore == NULL) || (_pointerLoopFinishedSemaphore == NULL))
+		{
+			LOG_ERROR("Failed to create the worker pool semaphores (%s).", SDL_GetError());
+			return -1;
+		}
+		
+		threadsCount = SDL_GetCPUCount() - 2;
+		if (threadsCount > CONFIGURATION_WORKER_POOL_MAXIMUM_THREADS_COUNT) threadsCount = CONFIGURATION_WORKER_POOL_MAXIMUM_THREADS_COUNT;
+		
+		// A missing thread only makes the loops slower, so there is no need to stop the game
+		for (_threadsCount = 0; _threadsCount < threadsCount; _threadsCount++)
+		{
+			_pointerThreads[_threadsCount] = SDL_CreateThread(_workerThread, "Worker", NULL);
+			if (_pointerThreads[_threadsCount] == NULL)
+			{
+				LOG_INFORMATION("Failed to create a worker thread (%s).", SDL_GetError());
+				break;
+			}
+		}
+		LOG_INFORMATION("Started %d worker threads.", _threadsCount);
+		
+		return 0;
+	}
+
+	void uninitialize()
+	{
+		int i;
+		
+		// Wake all threads up to make them exit
+		_isWorkerPoolStopped = true;
+		for (i = 0; i < _threadsCount; i++) SDL_SemPost(_pointerLoopStartedSemaphore);
+		for (i = 0; i < _threadsCount; i++) SDL_WaitThread(_pointerThreads[i], NULL);
+		_threadsCount = 0;
+		
+		if (_pointerLoopStartedSemaphore != NULL)
+		{
+			SDL_DestroySemaphore(_pointerLoopStartedSemaphore);
+			_pointerLoopStartedSemaphore = NULL;
+		}
+		if (_pointerLoopFinishedSemaphore != NULL)
+		{
+			SDL_DestroySemaphore(_pointerLoopFinishedSemaphore);
+			_pointerLoopFinishedSemaphore = NULL;
+		}
+	}
+
+	void runParallelLoop(void (*pointerFunction)(int itemIndex), int itemsCount)
+	{
+		int i;
+		
+		// Waking the threads up is not worth it for a few items
+		if ((_threadsCount == 0) || (itemsCount < CONFIGURATION_WORKER_POOL_MINIMUM_PARALLEL_ITEMS_COUNT))
+		{
+			for (i = 0; i < itemsCount; i++) pointerFunction(i);
+			return;
+		}
+		
+		// Start the loop on all threads
+		_pointerLoopFunction = pointerFunction;
+		_loopItemsCount = itemsCount;
+		SDL_AtomicSet(&_nextLoopItemIndex, 0);
+		for (i = 0; i < _threadsCount; i++) SDL_SemPost(_pointerLoopStartedSemaphore);
+		
+		// Take part in the work, then wait for the other threads to finish their last items
+		_processLoopItems();
+		for (i = 0; i < _threadsCount; i++) SDL_SemWait(_pointerLoopFinishedSemaphore);
+	}
+}
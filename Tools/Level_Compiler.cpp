@@ -0,0 +1,313 @@
+/** @file Level_Compiler.cpp
+ * Convert a level made with Tiled editor (x.tmx) to the compiled level format loaded by the game (x_Level.bin). The level is validated the same way the game does when loading the text files, and all data the game needs are precomputed, so the game can directly use the compiled level.
+ * Usage : Level_Compiler Development_Resources/x.tmx Levels/x_Level.bin (where x is the level number).
+ * @note The map layers must be stored using the CSV encoding.
+ * @author Adrien RICCIARDI
+ */
+#include <cerrno>
+#include <Configuration.hpp>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <LevelFile.hpp>
+#include <string>
+#include <vector>
+
+//-------------------------------------------------------------------------------------------------
+// Private constants and macros
+//-------------------------------------------------------------------------------------------------
+/** Tiled stores the tile flipping flags in the upper bits of a tile global ID. */
+#define TILED_FLIPPING_FLAGS_MASK 0xE0000000
+
+//-------------------------------------------------------------------------------------------------
+// Private functions
+//-------------------------------------------------------------------------------------------------
+/** Read the value of a XML attribute.
+ * @param stringElement The element containing the attribute (only the part starting with the element name is needed).
+ * @param pointerStringAttributeName The attribute name.
+ * @param stringValue On output, contain the attribute value.
+ * @return -1 if the attribute was not found,
+ * @return 0 on success.
+ */
+static int _readAttribute(const std::string &stringElement, const char *pointerStringAttributeName, std::string &stringValue)
+{
+	std::string stringSearchedPattern = std::string(" ") + pointerStringAttributeName + "=\"";
+	size_t startingPosition, endingPosition;
+
+	// Search only inside the element opening tag
+	endingPosition = stringElement.find('>');
+	startingPosition = stringElement.find(stringSearchedPattern);
+	if ((startingPosition == std::string::npos) || (startingPosition > endingPosition)) return -1;
+	startingPosition += stringSearchedPattern.size();
+
+	endingPosition = stringElement.find('"', startingPosition);
+	if (endingPosition == std::string::npos) return -1;
+
+	stringValue = stringElement.substr(startingPosition, endingPosition - startingPosition);
+	return 0;
+}
+
+/** Find the first global ID of a tileset.
+ * @param stringMap The whole map file content.
+ * @param pointerStringTilesetFileName The tileset file, as referenced by the map.
+ * @return -1 if the tileset is not used by the map,
+ * @return the tileset first global ID on success.
+ */
+static int _getTilesetFirstGlobalId(const std::string &stringMap, const char *pointerStringTilesetFileName)
+{
+	std::string stringElement, stringValue;
+	size_t position = 0;
+
+	while ((position = stringMap.find("<tileset ", position)) != std::string::npos)
+	{
+		stringElement = stringMap.substr(position);
+		position++;
+
+		if ((_readAttribute(stringElement, "source", stringValue) != 0) || (stringValue != pointerStringTilesetFileName)) continue;
+		if (_readAttribute(stringElement, "firstgid", stringValue) != 0) return -1;
+		return atoi(stringValue.c_str());
+	}
+
+	return -1;
+}
+
+/** Read a layer tile IDs. The tileset first global ID is subtracted from each tile, so empty tiles have the -1 value.
+ * @param stringMap The whole map file content.
+ * @param pointerStringLayerName The layer name.
+ * @param tilesetFirstGlobalId The first global ID of the tileset used by the layer.
+ * @param width The map width in blocks.
+ * @param height The map height in blocks.
+ * @param tiles On output, contain all tiles, row after row.
+ * @return -1 if an error occurred,
+ * @return 0 on success.
+ */
+static int _readLayer(const std::string &stringMap, const char *pointerStringLayerName, int tilesetFirstGlobalId, int width, int height, std::vector<int> &tiles)
+{
+	std::string stringElement, stringValue;
+	size_t position = 0, dataEndingPosition;
+	const char *pointerStringData;
+	char *pointerStringNextValue;
+	unsigned long globalId;
+
+	// Find the layer
+	while (true)
+	{
+		position = stringMap.find("<layer ", position);
+		if (position == std::string::npos)
+		{
+			printf("Error : the map has no \"%s\" layer.\n", pointerStringLayerName);
+			return -1;
+		}
+		stringElement = stringMap.substr(position, stringMap.find('>', position) - position + 1);
+		position++;
+
+		if ((_readAttribute(stringElement, "name", stringValue) == 0) && (stringValue == pointerStringLayerName)) break;
+	}
+
+	// Find the layer data, which must be CSV-encoded
+	position = stringMap.find("<data", position);
+	if (position == std::string::npos)
+	{
+		printf("Error : the \"%s\" layer has no data.\n", pointerStringLayerName);
+		return -1;
+	}
+	stringElement = stringMap.substr(position, stringMap.find('>', position) - position + 1);
+	if ((_readAttribute(stringElement, "encoding", stringValue) != 0) || (stringValue != "csv"))
+	{
+		printf("Error : the \"%s\" layer data must use the CSV encoding.\n", pointerStringLayerName);
+		return -1;
+	}
+	position = stringMap.find('>', position) + 1;
+	dataEndingPosition = stringMap.find("</data>", position);
+	if (dataEndingPosition == std::string::npos)
+	{
+		printf("Error : the \"%s\" layer data is not terminated.\n", pointerStringLayerName);
+		return -1;
+	}
+
+	// Convert all values
+	pointerStringData = stringMap.c_str() + position;
+	while (pointerStringData < stringMap.c_str() + dataEndingPosition)
+	{
+		globalId = strtoul(pointerStringData, &pointerStringNextValue, 10);
+		if (pointerStringNextValue == pointerStringData) break; // Only spaces remain before the end of the data
+
+		if (globalId & TILED_FLIPPING_FLAGS_MASK)
+		{
+			printf("Error : the \"%s\" layer contains a flipped or rotated tile, this is not supported by the game.\n", pointerStringLayerName);
+			return -1;
+		}
+		if (globalId == 0) tiles.push_back(-1); // Tiled uses 0 for empty tiles
+		else tiles.push_back(static_cast<int>(globalId) - tilesetFirstGlobalId);
+
+		// Discard the following comma
+		pointerStringData = pointerStringNextValue;
+		if (*pointerStringData == ',') pointerStringData++;
+	}
+
+	if (tiles.size() != static_cast<size_t>(width * height))
+	{
+		printf("Error : the \"%s\" layer contains %u tiles whereas the map is %dx%d blocks.\n", pointerStringLayerName, static_cast<unsigned int>(tiles.size()), width, height);
+		return -1;
+	}
+	return 0;
+}
+
+//-------------------------------------------------------------------------------------------------
+// Entry point
+//-------------------------------------------------------------------------------------------------
+int main(int argc, char *argv[])
+{
+	FILE *pointerFile;
+	std::string stringMap, stringValue;
+	char buffer[65536];
+	size_t readBytesCount;
+	std::vector<int> sceneTiles, objectTiles;
+	std::vector<LevelFile::EnemySpawner> enemySpawners;
+	std::vector<unsigned char> fileContent;
+	LevelFile::Header header;
+	LevelFile::EnemySpawner enemySpawner;
+	int width, height, sceneFirstGlobalId, objectsFirstGlobalId, x, y, i, playerX = 0, playerY = 0, playersCount = 0;
+	int16_t *pointerScenePlane;
+	uint8_t *pointerWallsBitmask;
+	int8_t *pointerObjectsPlane;
+
+	// Check parameters
+	if (argc != 3)
+	{
+		printf("Usage : %s Development_Resources/<level number>.tmx Levels/<level number>_Level.bin\n", argv[0]);
+		return -1;
+	}
+
+	// Load the whole map
+	pointerFile = fopen(argv[1], "r");
+	if (pointerFile == NULL)
+	{
+		printf("Error : could not open '%s' (%s).\n", argv[1], strerror(errno));
+		return -1;
+	}
+	while ((readBytesCount = fread(buffer, 1, sizeof(buffer), pointerFile)) > 0) stringMap.append(buffer, readBytesCount);
+	fclose(pointerFile);
+
+	// Retrieve the map size
+	if (stringMap.find("<map ") == std::string::npos)
+	{
+		printf("Error : '%s' is not a Tiled map.\n", argv[1]);
+		return -1;
+	}
+	if ((_readAttribute(stringMap.substr(stringMap.find("<map ")), "width", stringValue) != 0)) width = 0;
+	else width = atoi(stringValue.c_str());
+	if ((_readAttribute(stringMap.substr(stringMap.find("<map ")), "height", stringValue) != 0)) height = 0;
+	else height = atoi(stringValue.c_str());
+	if ((width <= 0) || (width > CONFIGURATION_LEVEL_MAXIMUM_WIDTH) || (height <= 0) || (height > CONFIGURATION_LEVEL_MAXIMUM_HEIGHT))
+	{
+		printf("Error : the map size is bad (maximum size is %dx%d blocks).\n", CONFIGURATION_LEVEL_MAXIMUM_WIDTH, CONFIGURATION_LEVEL_MAXIMUM_HEIGHT);
+		return -1;
+	}
+
+	// Tilesets order is not always the same, so tile IDs depend on the map
+	sceneFirstGlobalId = _getTilesetFirstGlobalId(stringMap, "Scene.tsx");
+	objectsFirstGlobalId = _getTilesetFirstGlobalId(stringMap, "Objects.tsx");
+	if ((sceneFirstGlobalId < 0) || (objectsFirstGlobalId < 0))
+	{
+		printf("Error : the map must use both Scene.tsx and Objects.tsx tilesets.\n");
+		return -1;
+	}
+
+	// Load both layers
+	if (_readLayer(stringMap, "Scene", sceneFirstGlobalId, width, height, sceneTiles) != 0) return -1;
+	if (_readLayer(stringMap, "Objects", objectsFirstGlobalId, width, height, objectTiles) != 0) return -1;
+
+	// Validate the scene
+	for (i = 0; i < width * height; i++)
+	{
+		if ((sceneTiles[i] < 0) || (sceneTiles[i] >= LEVEL_FILE_SCENE_TEXTURES_COUNT))
+		{
+			printf("Error : block (%d, %d) is not a scene block (tile ID : %d).\n", i % width, i / width, sceneTiles[i]);
+			return -1;
+		}
+	}
+
+	// Validate the objects, find the player and gather the enemy spawners
+	i = 0;
+	for (y = 0; y < height; y++)
+	{
+		for (x = 0; x < width; x++)
+		{
+			if ((objectTiles[i] < -1) || (objectTiles[i] >= LevelFile::OBJECT_IDS_COUNT))
+			{
+				printf("Error : block (%d, %d) is not an object (tile ID : %d).\n", x, y, objectTiles[i]);
+				return -1;
+			}
+
+			if (objectTiles[i] == LevelFile::OBJECT_ID_PLAYER)
+			{
+				playerX = x;
+				playerY = y;
+				playersCount++;
+				objectTiles[i] = -1; // The player location is stored in the header
+			}
+			else if (objectTiles[i] == LevelFile::OBJECT_ID_ENEMY_SPAWNER)
+			{
+				enemySpawner.x = x;
+				enemySpawner.y = y;
+				enemySpawners.push_back(enemySpawner);
+				objectTiles[i] = -1; // Enemy spawners are stored in their own list
+			}
+			i++;
+		}
+	}
+	if (playersCount != 1)
+	{
+		printf("Error : the map must contain exactly one player, but it contains %d players.\n", playersCount);
+		return -1;
+	}
+
+	// Lay out the file, all parts are aligned on 4 bytes
+	memset(&header, 0, sizeof(header));
+	header.magicNumber = LEVEL_FILE_MAGIC_NUMBER;
+	header.version = LEVEL_FILE_VERSION;
+	header.widthBlocks = width;
+	header.heightBlocks = height;
+	header.playerX = playerX;
+	header.playerY = playerY;
+	header.enemySpawnersCount = enemySpawners.size();
+	header.scenePlaneOffset = sizeof(header);
+	header.wallsBitmaskOffset = header.scenePlaneOffset + (((width * height * sizeof(int16_t)) + 3) & ~3);
+	header.objectsPlaneOffset = header.wallsBitmaskOffset + (((((width * height) + 7) / 8) + 3) & ~3);
+	header.enemySpawnersOffset = header.objectsPlaneOffset + (((width * height * sizeof(int8_t)) + 3) & ~3);
+	header.fileSize = header.enemySpawnersOffset + (enemySpawners.size() * sizeof(LevelFile::EnemySpawner));
+
+	// Fill the file content
+	fileContent.resize(header.fileSize, 0);
+	memcpy(&fileContent[0], &header, sizeof(header));
+	pointerScenePlane = reinterpret_cast<int16_t *>(&fileContent[header.scenePlaneOffset]);
+	pointerWallsBitmask = &fileContent[header.wallsBitmaskOffset];
+	pointerObjectsPlane = reinterpret_cast<int8_t *>(&fileContent[header.objectsPlaneOffset]);
+	for (i = 0; i < width * height; i++)
+	{
+		pointerScenePlane[i] = sceneTiles[i];
+		if (sceneTiles[i] >= LEVEL_FILE_SCENE_FLOOR_TEXTURES_COUNT) pointerWallsBitmask[i / 8] |= 1 << (i % 8);
+		pointerObjectsPlane[i] = objectTiles[i];
+	}
+	if (!enemySpawners.empty()) memcpy(&fileContent[header.enemySpawnersOffset], &enemySpawners[0], enemySpawners.size() * sizeof(LevelFile::EnemySpawner));
+
+	// Write the compiled level
+	pointerFile = fopen(argv[2], "wb");
+	if (pointerFile == NULL)
+	{
+		printf("Error : could not create '%s' (%s).\n", argv[2], strerror(errno));
+		return -1;
+	}
+	if (fwrite(&fileContent[0], 1, fileContent.size(), pointerFile) != fileContent.size())
+	{
+		printf("Error : could not write '%s' (%s).\n", argv[2], strerror(errno));
+		fclose(pointerFile);
+		return -1;
+	}
+	fclose(pointerFile);
+
+	printf("Compiled '%s' to '%s' (%dx%d blocks, %u enemy spawners).\n", argv[1], argv[2], width, height, static_cast<unsigned int>(enemySpawners.size()));
+	return 0;
+}